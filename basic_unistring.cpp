@@ -27,77 +27,834 @@
 //
 //
 
-#include "basic_unistring.h"
-#include <codecvt>
-#include "utf8proc.h"
 #include <algorithm>
 #include <sstream>
 #include <array>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+#include "basic_unistring.h"
+#include "utf8proc.h"
 
 namespace {
-    template <typename FromType, typename ToType>
+    template <typename ToType, typename FromType, typename Convert>
     std::basic_string<ToType>
-        convertIn(basic_unistring<FromType> const &internal, std::codecvt<FromType, ToType, std::mbstate_t> const &codecvt);
-
-    template <typename FromType, typename ToType>
-    std::basic_string<FromType>
-        convertOut(basic_unistring<ToType> const &internal, std::codecvt<FromType, ToType, std::mbstate_t> const &codecvt);
+        transcode(basic_unistring<FromType> const &internal, std::size_t length, bool ascii, Convert convert);
 }
 
 template <>
 template <typename CharType2, typename>
 basic_unistring<char>::basic_unistring(basic_unistring<CharType2> const &str)
-        : basic_string<char>(str.to_utf8()) {}
+        : basic_string<char>(str.to_utf8()), flags(str.flags) {}
 
 template <>
 template <typename CharType2, typename>
 basic_unistring<char16_t>::basic_unistring(basic_unistring<CharType2> const &str)
-        : basic_string<char16_t>(str.to_utf16()) {}
+        : basic_string<char16_t>(str.to_utf16()), flags(str.flags) {}
 
 template <>
 template <typename CharType2, typename>
 basic_unistring<char32_t>::basic_unistring(basic_unistring<CharType2> const &str)
-        : basic_string<char32_t>(str.to_utf32()) {}
+        : basic_string<char32_t>(str.to_utf32()), flags(str.flags) {}
+
+namespace {
+    basic_unistring<char> checked_utf8(char const *str, size_t length) {
+        if(!unistring_kernels::validate_utf8(str, length)) {
+            throw std::invalid_argument(utf8proc_errmsg(UTF8PROC_ERROR_INVALIDUTF8));
+        }
+
+        return basic_unistring<char>(str, length);
+    }
+}
+
+template <typename CharType, typename T>
+basic_unistring<CharType, T>::basic_unistring(unistring_checked_t, char const *str, size_type length)
+        : basic_unistring(checked_utf8(str, length)) {
+    this->check_ascii();
+}
+
+template <typename CharType, typename T>
+void basic_unistring<CharType, T>::check_ascii() {
+    if(unistring_kernels::is_ascii(this->base_type::data(), this->size())) {
+        flags |= ascii_flags;
+    }
+}
+
+template <typename CharType, typename T>
+bool basic_unistring<CharType, T>::is_normalized(unistring_normalization_form form) const {
+    if(flags & form_flag(form)) {
+        return true;
+    }
+    switch(unistring_normalizer::quick_check(this->data(), this->size(), form)) {
+        case UTF8PROC_QC_YES:
+            return true;
+        case UTF8PROC_QC_NO:
+            return false;
+        default:
+            return this->normalized(form) == *this;
+    }
+}
+
+template <typename CharType, typename T>
+bool basic_unistring<CharType, T>::passes_quick_check(unistring_normalization_form form) const {
+    return (flags & form_flag(form)) ||
+           unistring_normalizer::quick_check(this->data(), this->size(), form) == UTF8PROC_QC_YES;
+}
 
 template <typename CharType, typename T>
-basic_unistring<CharType, T> basic_unistring<CharType, T>::get_normalized() const {
-    return reinterpret_cast<char const *>(utf8proc_NFC(reinterpret_cast<utf8proc_uint8_t const *>(to_utf8().c_str())));
+unsigned char basic_unistring<CharType, T>::concatenation_flags(basic_unistring const &other) const {
+    if(other.empty()) {
+        return flags;
+    } else if(this->empty()) {
+        return other.flags;
+    }
+
+    unsigned char const common = flags & other.flags;
+    if(common & known_ascii) {
+        return common;
+    }
+    unsigned char joined = 0;
+    for(int form = 0; form <= static_cast<int>(unistring_normalization_form::nfkc_casefold); ++form) {
+        auto const normalization = static_cast<unistring_normalization_form>(form);
+        if((common & form_flag(normalization)) &&
+           unistring_normalizer::has_boundary_before(other.data(), other.size(), normalization)) {
+            joined |= form_flag(normalization);
+        }
+    }
+
+    return joined;
+}
+
+namespace {
+    /*
+     * Largest capacity, in units, a scratch string of a thread keeps from one normalization to the next. A larger one
+     * is released on scope exit, so that normalizing one large document does not pin its size on the thread for good.
+     */
+    constexpr std::size_t retained_scratch_capacity = std::size_t(1) << 16;
+
+    template <typename CharType>
+    class scratch_release {
+    public:
+        explicit scratch_release(std::basic_string<CharType> &scratch) : scratch(scratch) {}
+        scratch_release(scratch_release const &) = delete;
+        scratch_release &operator=(scratch_release const &) = delete;
+
+        ~scratch_release() {
+            if(scratch.capacity() > retained_scratch_capacity) {
+                std::basic_string<CharType>().swap(scratch);
+            }
+        }
+
+    private:
+        std::basic_string<CharType> &scratch;
+    };
+
+    template <typename CharType>
+    void normalize_to(unistring_normalizer &normalizer, CharType const *str, std::size_t length,
+                      std::basic_string<CharType> &out) {
+        if(!normalizer.normalize(str, length, out)) {
+            throw std::invalid_argument(utf8proc_errmsg(UTF8PROC_ERROR_INVALIDUTF8));
+        }
+    }
+}
+
+template <typename CharType, typename T>
+void basic_unistring<CharType, T>::normalize(unistring_normalization_form form) {
+    if(flags & form_flag(form)) {
+        return;
+    }
+    thread_local base_type scratch;
+    scratch_release<CharType> const release(scratch);
+    if(this->normalize_into(unistring_normalizer::of_thread(form), scratch)) {
+        this->assign_normalized(scratch, form);
+    } else {
+        flags |= form_flag(form);
+    }
+}
+
+template <typename CharType, typename T>
+void basic_unistring<CharType, T>::assign_normalized(base_type const &scratch, unistring_normalization_form form) {
+    this->drop_derived_state();
+    this->base_type::assign(scratch);
+    flags = form_flag(form);
+}
+
+template <typename CharType, typename T>
+basic_unistring<CharType, T> &basic_unistring<CharType, T>::append_normalized(basic_unistring const &value,
+                                                                              unistring_normalization_form form) {
+    // What is normalized is gathered apart and only replaces the string once done, so that the string is left as it
+    // was if either is ill-formed.
+    thread_local base_type region, scratch;
+    scratch_release<CharType> const release_region(region), release_scratch(scratch);
+    if(!(flags & form_flag(form))) {
+        if(!this->passes_quick_check(form)) {
+            region.assign(this->base_type::data(), this->size());
+            region.append(value.data(), value.size());
+            scratch.clear();
+            normalize_to(unistring_normalizer::of_thread(form), region.data(), region.size(), scratch);
+            this->assign_normalized(scratch, form);
+
+            return *this;
+        }
+        flags |= form_flag(form);
+    }
+
+    unsigned char const joined = this->concatenation_flags(value);
+    size_type const start = unistring_normalizer::has_boundary_before(value.data(), value.size(), form)
+                                ? this->size()
+                                : unistring_normalizer::last_boundary(this->base_type::data(), this->size(), form);
+    CharType const *str = value.data();
+    size_type length = value.size();
+    if(start != this->size()) {
+        region.assign(this->base_type::data() + start, this->size() - start);
+        region.append(value.data(), value.size());
+        str = region.data();
+        length = region.size();
+    }
+    if(start != this->size() || !value.passes_quick_check(form)) {
+        scratch.clear();
+        normalize_to(unistring_normalizer::of_thread(form), str, length, scratch);
+        str = scratch.data();
+        length = scratch.size();
+    }
+
+    this->drop_derived_state();
+    this->base_type::replace(start, npos, str, length);
+    flags = (joined & form_flag(form)) ? joined : form_flag(form);
+
+    return *this;
+}
+
+template <typename CharType, typename T>
+basic_unistring<CharType, T> basic_unistring<CharType, T>::normalized(unistring_normalization_form form) const {
+    basic_unistring result;
+    normalize_to(unistring_normalizer::of_thread(form), this->data(), this->size(), static_cast<base_type &>(result));
+    result.flags = form_flag(form);
+
+    return result;
+}
+
+template <typename CharType, typename T>
+basic_unistring<CharType, T>
+basic_unistring<CharType, T>::get_normalized(unistring_normalization_cache<CharType> &cache) const {
+    basic_unistring result;
+    if(!cache.normalize(this->data(), this->size(), static_cast<base_type &>(result))) {
+        throw std::invalid_argument(utf8proc_errmsg(UTF8PROC_ERROR_INVALIDUTF8));
+    }
+    result.flags = form_flag(cache.form());
+
+    return result;
+}
+
+template <typename CharType, typename T>
+basic_unistring<CharType, T> basic_unistring<CharType, T>::get_normalized_parallel(unistring_normalization_form form,
+                                                                                  unsigned threads) const {
+    if(this->passes_quick_check(form)) {
+        basic_unistring result(*this);
+        result.flags |= form_flag(form);
+        return result;
+    }
+    unistring_normalizer normalizer(form);
+    basic_unistring result;
+    if(!normalizer.normalize_parallel(this->data(), this->size(), static_cast<base_type &>(result), threads)) {
+        throw std::invalid_argument(utf8proc_errmsg(UTF8PROC_ERROR_INVALIDUTF8));
+    }
+    result.flags = form_flag(form);
+
+    return result;
+}
+
+template <typename CharType, typename T>
+bool basic_unistring<CharType, T>::normalize_into(unistring_normalizer &normalizer, base_type &scratch) const {
+    if(this->passes_quick_check(normalizer.form())) {
+        return false;
+    }
+    scratch.clear();
+    normalize_to(normalizer, this->data(), this->size(), scratch);
+
+    return true;
 }
 
 template <>
 template <>
 std::string basic_unistring<char16_t>::to_utf8<false>() const {
-    return convertIn(*this, std::codecvt_utf8_utf16<char_type>{});
+    std::size_t const length = unistring_kernels::utf8_length_from_utf16(this->data(), this->size());
+    return transcode<char>(*this, length, length == this->size(), unistring_kernels::convert_utf16_to_utf8);
 }
 
 template <>
 template <>
 std::string basic_unistring<char32_t>::to_utf8<false>() const {
-    return convertIn(*this, std::codecvt_utf8<char_type>{});
+    std::size_t const length = unistring_kernels::utf8_length_from_utf32(this->data(), this->size());
+    return transcode<char>(*this, length, length == this->size(), unistring_kernels::convert_utf32_to_utf8);
 }
 
 template <>
 template <>
 std::u16string basic_unistring<char>::to_utf16<false>() const {
-    return convertOut(*this, std::codecvt_utf8_utf16<char16_t>{});
+    bool ascii;
+    std::size_t const length = unistring_kernels::utf16_length_from_utf8(this->data(), this->size(), ascii);
+    return transcode<char16_t>(*this, length, ascii, unistring_kernels::convert_utf8_to_utf16);
 }
 
 template <>
 template <>
 std::basic_string<char16_t> basic_unistring<char32_t>::to_utf16<false>() const {
-    return basic_unistring<char>(this->to_utf8()).to_utf16();
+    std::size_t const length = unistring_kernels::utf16_length_from_utf32(this->data(), this->size());
+    return transcode<char16_t>(*this, length, false, unistring_kernels::convert_utf32_to_utf16);
 }
 
 template <>
 template <>
 std::u32string basic_unistring<char>::to_utf32<false>() const {
-    return convertOut(*this, std::codecvt_utf8<char32_t>{});
+    bool ascii;
+    std::size_t const length = unistring_kernels::utf32_length_from_utf8(this->data(), this->size(), ascii);
+    return transcode<char32_t>(*this, length, ascii, unistring_kernels::convert_utf8_to_utf32);
 }
 
 template <>
 template <>
 std::basic_string<char32_t> basic_unistring<char16_t>::to_utf32<false>() const {
-    return basic_unistring<char>(this->to_utf8()).to_utf32();
+    std::size_t const length = unistring_kernels::utf32_length_from_utf16(this->data(), this->size());
+    return transcode<char32_t>(*this, length, false, unistring_kernels::convert_utf16_to_utf32);
+}
+
+namespace {
+    /*
+     * Length and conversion kernels for each pair of encodings, the identity included.
+     */
+    template <typename FromType, typename ToType>
+    struct transcoder;
+
+    template <typename CharType>
+    struct transcoder<CharType, CharType> {
+        static std::size_t length(CharType const *, std::size_t length) {
+            return length;
+        }
+        static unistring_kernels::conversion_result convert(CharType const *str, std::size_t length, CharType *out) {
+            std::copy_n(str, length, out);
+            return {length, length};
+        }
+    };
+
+#define UNISTRING_TRANSCODER(FromType, ToType, length_kernel, convert_kernel)                                    \
+    template <>                                                                                                \
+    struct transcoder<FromType, ToType> {                                                                      \
+        static std::size_t length(FromType const *str, std::size_t length) {                                   \
+            return unistring_kernels::length_kernel(str, length);                                              \
+        }                                                                                                      \
+        static unistring_kernels::conversion_result convert(FromType const *str, std::size_t length, ToType *out) { \
+            return unistring_kernels::convert_kernel(str, length, out);                                        \
+        }                                                                                                      \
+    };
+
+    UNISTRING_TRANSCODER(char, char16_t, utf16_length_from_utf8, convert_utf8_to_utf16)
+    UNISTRING_TRANSCODER(char, char32_t, utf32_length_from_utf8, convert_utf8_to_utf32)
+    UNISTRING_TRANSCODER(char16_t, char, utf8_length_from_utf16, convert_utf16_to_utf8)
+    UNISTRING_TRANSCODER(char16_t, char32_t, utf32_length_from_utf16, convert_utf16_to_utf32)
+    UNISTRING_TRANSCODER(char32_t, char, utf8_length_from_utf32, convert_utf32_to_utf8)
+    UNISTRING_TRANSCODER(char32_t, char16_t, utf16_length_from_utf32, convert_utf32_to_utf16)
+#undef UNISTRING_TRANSCODER
+
+    /*
+     * Number of units of the sequence at the beginning of str: a lead byte and its continuation bytes, a surrogate pair,
+     * or a single unit.
+     */
+    std::size_t sequence_length(char const *str, std::size_t remaining) {
+        std::size_t length = 1;
+        while(length < remaining && (str[length] & 0xC0) == 0x80) {
+            ++length;
+        }
+
+        return length;
+    }
+
+    std::size_t sequence_length(char16_t const *str, std::size_t remaining) {
+        return remaining > 1 && (str[1] & 0xFC00) == 0xDC00 ? 2 : 1;
+    }
+
+    std::size_t sequence_length(char32_t const *, std::size_t) {
+        return 1;
+    }
+
+    /*
+     * Returns the start of the sequence that pos falls in. A run of more continuation bytes than a sequence holds is
+     * ill-formed anyway, and is cut at pos.
+     */
+    std::size_t sequence_start(char const *str, std::size_t pos) {
+        std::size_t start = pos;
+        while(start > 0 && pos - start < 3 && (str[start] & 0xC0) == 0x80) {
+            --start;
+        }
+
+        return (str[start] & 0xC0) == 0x80 ? pos : start;
+    }
+
+    std::size_t sequence_start(char16_t const *str, std::size_t pos) {
+        return pos > 0 && (str[pos] & 0xFC00) == 0xDC00 && (str[pos - 1] & 0xFC00) == 0xD800 ? pos - 1 : pos;
+    }
+
+    std::size_t sequence_start(char32_t const *, std::size_t pos) {
+        return pos;
+    }
+
+    /**
+     * Returns the length of the longest prefix of str made of whole sequences whose conversion takes at most capacity
+     * units. The length kernels count unit by unit, so summing them over sequences gives the length of the prefix.
+     */
+    template <typename FromType, typename ToType>
+    std::size_t fitting_prefix(FromType const *str, std::size_t length, std::size_t capacity) {
+        std::size_t pos = 0, used = 0;
+        while(pos < length) {
+            std::size_t const units = sequence_length(str + pos, length - pos);
+            std::size_t const converted = transcoder<FromType, ToType>::length(str + pos, units);
+            if(used + converted > capacity) {
+                break;
+            }
+            used += converted;
+            pos += units;
+        }
+
+        return pos;
+    }
+}
+
+template <typename CharType, typename T>
+template <typename ToType>
+unistring_transcode_result basic_unistring<CharType, T>::transcode_into(ToType *out, size_type capacity) const {
+    size_type const required = transcoder<CharType, ToType>::length(this->data(), this->size());
+    size_type length = this->size();
+    if(required > capacity) {
+        length = fitting_prefix<CharType, ToType>(this->data(), length, capacity);
+    }
+    auto result = transcoder<CharType, ToType>::convert(this->data(), length, out);
+
+    return {result.written, required, required > capacity};
+}
+
+template <typename CharType, typename T>
+template <typename ToType>
+unistring_kernels::conversion_result
+    basic_unistring<CharType, T>::transcode_prefix(size_type pos, ToType *out, size_type capacity) const {
+    // Only a window of capacity units is looked at, cut at a sequence boundary, so that each call costs in proportion to
+    // what it converts rather than to the rest of the string.
+    auto const str = this->data() + pos;
+    size_type length = this->size() - pos;
+    if(length > capacity) {
+        length = sequence_start(str, capacity);
+        if(length == 0) {
+            length = sequence_length(str, this->size() - pos);
+        }
+    }
+    if(transcoder<CharType, ToType>::length(str, length) > capacity) {
+        length = fitting_prefix<CharType, ToType>(str, length, capacity);
+    }
+
+    return transcoder<CharType, ToType>::convert(str, length, out);
+}
+
+namespace {
+    std::size_t advance_units(char const *str, std::size_t length, std::size_t count) {
+        return unistring_kernels::advance_utf8(str, length, count);
+    }
+
+    std::size_t advance_units(char16_t const *str, std::size_t length, std::size_t count) {
+        return unistring_kernels::advance_utf16(str, length, count);
+    }
+
+    std::size_t advance_units(char32_t const *, std::size_t length, std::size_t count) {
+        return std::min(length, count);
+    }
+}
+
+template <typename CharType, typename T>
+typename basic_unistring<CharType, T>::size_type basic_unistring<CharType, T>::codepoint_count() const {
+    if(auto index = std::atomic_load(&offset_index)) {
+        return index->count;
+    }
+
+    return transcoder<CharType, char32_t>::length(this->data(), this->size());
+}
+
+template <typename CharType, typename T>
+typename basic_unistring<CharType, T>::size_type
+    basic_unistring<CharType, T>::advance_codepoints(size_type pos, size_type count) const {
+    if(pos > this->size()) {
+        throw std::out_of_range("basic_unistring::advance_codepoints");
+    }
+
+    return pos + advance_units(this->data() + pos, this->size() - pos, count);
+}
+
+template <typename CharType, typename T>
+struct basic_unistring<CharType, T>::codepoint_offset_index {
+    size_type count;
+
+    /**
+     * Position of every offset_index_stride-th code point, starting with the first one.
+     */
+    std::vector<size_type> positions;
+};
+
+namespace {
+    constexpr std::size_t offset_index_stride = 64;
+}
+
+template <typename CharType, typename T>
+std::shared_ptr<typename basic_unistring<CharType, T>::codepoint_offset_index const>
+    basic_unistring<CharType, T>::get_offset_index() const {
+    std::shared_ptr<codepoint_offset_index const> index = std::atomic_load(&offset_index);
+    if(index) {
+        return index;
+    }
+
+    // Concurrent builds give the same index, so the last one stored wins.
+    auto built = std::make_shared<codepoint_offset_index>();
+    built->count = transcoder<CharType, char32_t>::length(this->data(), this->size());
+    built->positions.reserve(built->count / offset_index_stride + 1);
+    built->positions.push_back(0);
+    size_type pos = 0;
+    for(size_type indexed = offset_index_stride; indexed <= built->count; indexed += offset_index_stride) {
+        pos += advance_units(this->data() + pos, this->size() - pos, offset_index_stride);
+        built->positions.push_back(pos);
+    }
+    index = std::move(built);
+    std::atomic_store(&offset_index, index);
+
+    return index;
+}
+
+template <typename CharType, typename T>
+typename basic_unistring<CharType, T>::size_type basic_unistring<CharType, T>::codepoint_offset(size_type index) const {
+    // UTF-32 needs no index.
+    if(std::is_same<CharType, char32_t>::value) {
+        if(index > this->size()) {
+            throw std::out_of_range("basic_unistring::codepoint_offset");
+        }
+        return index;
+    }
+
+    auto offsets = this->get_offset_index();
+    if(index > offsets->count) {
+        throw std::out_of_range("basic_unistring::codepoint_offset");
+    }
+    size_type const pos = offsets->positions[index / offset_index_stride];
+
+    return pos + advance_units(this->data() + pos, this->size() - pos, index % offset_index_stride);
+}
+
+template <typename CharType, typename T>
+typename basic_unistring<CharType, T>::size_type basic_unistring<CharType, T>::codepoint_index(size_type pos) const {
+    if(pos > this->size()) {
+        throw std::out_of_range("basic_unistring::codepoint_index");
+    } else if(std::is_same<CharType, char32_t>::value) {
+        return pos;
+    }
+
+    auto offsets = this->get_offset_index();
+    auto const block = std::upper_bound(offsets->positions.begin(), offsets->positions.end(), pos) - 1;
+    size_type const indexed = (block - offsets->positions.begin()) * offset_index_stride;
+
+    return indexed + transcoder<CharType, char32_t>::length(this->data() + *block, pos - *block);
+}
+
+template <typename CharType, typename T>
+char32_t basic_unistring<CharType, T>::codepoint_at(size_type index) const {
+    size_type const pos = this->codepoint_offset(index);
+    if(index == this->codepoint_count()) {
+        throw std::out_of_range("basic_unistring::codepoint_at");
+    }
+
+    size_type const length = advance_units(this->data() + pos, this->size() - pos, 1);
+    char32_t codepoint;
+    auto const decoded = transcoder<CharType, char32_t>::convert(this->data() + pos, length, &codepoint);
+
+    return decoded.read == length && decoded.written == 1 ? codepoint : 0xFFFD;
+}
+
+template <typename CharType, typename T>
+basic_unistring<CharType, T> basic_unistring<CharType, T>::codepoint_substr(size_type index, size_type count) const {
+    size_type const first = this->codepoint_offset(index);
+    size_type const last = count >= this->codepoint_count() - index ? this->size() : this->codepoint_offset(index + count);
+
+    return basic_unistring(*this, first, last - first);
+}
+
+template <typename CharType, typename T>
+basic_unistring<CharType, T> &
+    basic_unistring<CharType, T>::codepoint_replace(size_type index, size_type count, basic_unistring const &value) {
+    size_type const first = this->codepoint_offset(index);
+    size_type const last = count >= this->codepoint_count() - index ? this->size() : this->codepoint_offset(index + count);
+
+    return this->replace(first, last - first, value);
+}
+
+template <typename CharType, typename T>
+typename basic_unistring<CharType, T>::size_type
+    basic_unistring<CharType, T>::advance_graphemes(size_type pos, size_type count) const {
+    CharType const *const last = this->data() + this->size();
+    unistring_grapheme_iterator<CharType> cluster(this->data(), this->data() + pos, last);
+    for(; count > 0; --count, ++cluster) {
+        if(cluster.base() == last) {
+            return npos;
+        }
+    }
+
+    return cluster.base() - this->data();
+}
+
+template <typename CharType, typename T>
+basic_unistring<CharType, T> basic_unistring<CharType, T>::substr_graphemes(size_type index, size_type count) const {
+    size_type const first = this->advance_graphemes(0, index);
+    if(first == npos) {
+        throw std::out_of_range("basic_unistring::substr_graphemes");
+    }
+    size_type const last = count == npos ? npos : this->advance_graphemes(first, count);
+
+    return basic_unistring(*this, first, last == npos ? npos : last - first);
+}
+
+template <typename CharType, typename T>
+basic_unistring<CharType, T> &basic_unistring<CharType, T>::truncate_graphemes(size_type count) {
+    size_type const last = this->advance_graphemes(0, count);
+    if(last != npos && last != this->size()) {
+        this->erase(last);
+    }
+
+    return *this;
+}
+
+namespace {
+    /*
+     * Number of units of a sequence, as announced by its first unit. Units that cannot start a sequence count as one,
+     * which lets the conversion report them.
+     */
+    std::size_t announced_length(char lead) {
+        std::size_t const length = utf8proc_utf8class[static_cast<unsigned char>(lead)];
+        return length == 0 ? 1 : length;
+    }
+
+    std::size_t announced_length(char16_t lead) {
+        return (lead & 0xFC00) == 0xD800 ? 2 : 1;
+    }
+
+    std::size_t announced_length(char32_t) {
+        return 1;
+    }
+
+    bool is_trailing_unit(char unit) {
+        return (unit & 0xC0) == 0x80;
+    }
+
+    bool is_trailing_unit(char16_t unit) {
+        return (unit & 0xFC00) == 0xDC00;
+    }
+
+    bool is_trailing_unit(char32_t) {
+        return false;
+    }
+
+    /**
+     * Returns the number of units at the end of str that begin a sequence without completing it.
+     */
+    template <typename FromType>
+    std::size_t incomplete_tail(FromType const *str, std::size_t length) {
+        for(std::size_t back = 1; back <= std::min<std::size_t>(length, 3); ++back) {
+            FromType const unit = str[length - back];
+            if(!is_trailing_unit(unit)) {
+                return announced_length(unit) > back ? back : 0;
+            }
+        }
+
+        return 0;
+    }
+
+    /**
+     * Appends the conversion of str to out. Returns false if str is ill-formed.
+     */
+    template <typename FromType, typename ToType>
+    bool append_converted(FromType const *str, std::size_t length, std::basic_string<ToType> &out) {
+        std::size_t const offset = out.size();
+        out.resize(offset + transcoder<FromType, ToType>::length(str, length));
+        auto result = transcoder<FromType, ToType>::convert(str, length, &out[0] + offset);
+        out.resize(offset + result.written);
+
+        return result.read == length;
+    }
+}
+
+template <typename FromType, typename ToType>
+bool unistring_stream_transcoder<FromType, ToType>::feed(FromType const *str, size_t length, std::basic_string<ToType> &out) {
+    if(failed) {
+        return false;
+    }
+
+    if(carry_length > 0) {
+        std::size_t const missing = announced_length(carry[0]) - carry_length;
+        std::size_t const taken = std::min(missing, length);
+        std::copy_n(str, taken, carry.begin() + carry_length);
+        carry_length += taken;
+        str += taken;
+        length -= taken;
+        if(taken < missing) {
+            return true;
+        }
+
+        failed = !append_converted(carry.data(), carry_length, out);
+        carry_length = 0;
+        if(failed) {
+            return false;
+        }
+    }
+
+    std::size_t const tail = incomplete_tail(str, length);
+    failed = !append_converted(str, length - tail, out);
+    if(failed) {
+        return false;
+    }
+    std::copy_n(str + length - tail, tail, carry.begin());
+    carry_length = tail;
+
+    return true;
+}
+
+template <typename FromType, typename ToType>
+bool unistring_stream_transcoder<FromType, ToType>::finish() {
+    bool const complete = !failed && carry_length == 0;
+    this->reset();
+
+    return complete;
+}
+
+namespace {
+    using unistring_kernels::legacy_encoding;
+
+    /*
+     * Conversions between a legacy encoding and each of the Unicode ones.
+     */
+    template <typename CharType>
+    struct legacy_codec;
+
+    template <>
+    struct legacy_codec<char> {
+        static std::size_t length(legacy_encoding encoding, char const *str, std::size_t length) {
+            return unistring_kernels::utf8_length_from_legacy(encoding, str, length);
+        }
+        static void decode(legacy_encoding encoding, char const *str, std::size_t length, char *out) {
+            unistring_kernels::convert_legacy_to_utf8(encoding, str, length, out);
+        }
+        static unistring_kernels::conversion_result
+            encode(legacy_encoding encoding, char const *str, std::size_t length, char *out) {
+            return unistring_kernels::convert_utf8_to_legacy(encoding, str, length, out);
+        }
+    };
+
+    template <>
+    struct legacy_codec<char16_t> {
+        static std::size_t length(legacy_encoding, char const *, std::size_t length) {
+            return length;
+        }
+        static void decode(legacy_encoding encoding, char const *str, std::size_t length, char16_t *out) {
+            unistring_kernels::convert_legacy_to_utf16(encoding, str, length, out);
+        }
+        static unistring_kernels::conversion_result
+            encode(legacy_encoding encoding, char16_t const *str, std::size_t length, char *out) {
+            return unistring_kernels::convert_utf16_to_legacy(encoding, str, length, out);
+        }
+    };
+
+    template <>
+    struct legacy_codec<char32_t> {
+        static std::size_t length(legacy_encoding, char const *, std::size_t length) {
+            return length;
+        }
+        static void decode(legacy_encoding encoding, char const *str, std::size_t length, char32_t *out) {
+            unistring_kernels::convert_legacy_to_utf32(encoding, str, length, out);
+        }
+        static unistring_kernels::conversion_result
+            encode(legacy_encoding encoding, char32_t const *str, std::size_t length, char *out) {
+            return unistring_kernels::convert_utf32_to_legacy(encoding, str, length, out);
+        }
+    };
+
+    template <typename CharType>
+    basic_unistring<CharType> from_legacy(legacy_encoding encoding, char const *str, std::size_t length) {
+        basic_unistring<CharType> result(legacy_codec<CharType>::length(encoding, str, length), CharType{});
+        if(!result.empty()) {
+            legacy_codec<CharType>::decode(encoding, str, length, &result[0]);
+        }
+
+        return result;
+    }
+
+    /*
+     * Length of the well-formed sequence at the beginning of str, or 0 if it is ill-formed.
+     */
+    std::size_t well_formed_length(char const *str, std::size_t remaining) {
+        std::size_t const length = announced_length(*str);
+        return length <= remaining && unistring_kernels::validate_utf8(str, length) ? length : 0;
+    }
+
+    std::size_t well_formed_length(char16_t const *str, std::size_t remaining) {
+        if(announced_length(*str) == 2) {
+            return remaining >= 2 && is_trailing_unit(str[1]) ? 2 : 0;
+        }
+
+        return is_trailing_unit(*str) ? 0 : 1;
+    }
+
+    std::size_t well_formed_length(char32_t const *str, std::size_t) {
+        return *str < 0x110000 && (*str & 0xFFFFF800) != 0xD800 ? 1 : 0;
+    }
+
+    /**
+     * Converts str with the kernels, which stop at each character the encoding lacks; those are replaced by '?'. Every
+     * code point takes one byte, so the string length is enough room.
+     */
+    template <typename CharType>
+    std::string to_legacy(basic_unistring<CharType> const &str, legacy_encoding encoding) {
+        std::string result(str.size(), '\0');
+        std::size_t pos = 0, written = 0;
+        while(pos < str.size()) {
+            auto converted = legacy_codec<CharType>::encode(encoding, str.data() + pos, str.size() - pos, &result[written]);
+            pos += converted.read;
+            written += converted.written;
+            std::size_t const skipped = pos < str.size() ? well_formed_length(str.data() + pos, str.size() - pos) : 0;
+            if(skipped == 0) {
+                break;
+            }
+            result[written++] = '?';
+            pos += skipped;
+        }
+        result.resize(written);
+
+        return result;
+    }
+}
+
+template <typename CharType, typename T>
+basic_unistring<CharType, T>::basic_unistring(unistring_latin1_t, char const *str, size_type length)
+        : basic_unistring(from_legacy<CharType>(legacy_encoding::latin1, str, length)) {
+    this->check_ascii();
+}
+
+template <typename CharType, typename T>
+basic_unistring<CharType, T>::basic_unistring(unistring_windows1252_t, char const *str, size_type length)
+        : basic_unistring(from_legacy<CharType>(legacy_encoding::windows1252, str, length)) {
+    this->check_ascii();
+}
+
+template <typename CharType, typename T>
+std::string basic_unistring<CharType, T>::to_latin1() const {
+    return to_legacy(*this, legacy_encoding::latin1);
+}
+
+template <typename CharType, typename T>
+std::string basic_unistring<CharType, T>::to_windows1252() const {
+    return to_legacy(*this, legacy_encoding::windows1252);
 }
 
 template <typename CharType, typename T>
@@ -111,54 +868,305 @@ bool basic_unistring<CharType, T>::ends_with(basic_unistring<CharType> const &su
 }
 
 namespace {
-    template <typename FromType, typename ToType>
+    /**
+     * Converts internal with the given kernel: the output is sized by the length kernel, filled in a single pass, then
+     * cut where the conversion stopped. A string the length kernel found to be ASCII is simply widened or narrowed:
+     * the UTF-8 length kernels tell it, and only ASCII strings take one UTF-8 byte per UTF-16 or UTF-32 unit. Between
+     * UTF-16 and UTF-32, the conversion kernels are left to it.
+     */
+    template <typename ToType, typename FromType, typename Convert>
     std::basic_string<ToType>
-        convertIn(basic_unistring<FromType> const &internal, std::codecvt<FromType, ToType, std::mbstate_t> const &codecvt) {
-        std::string external(internal.size() * codecvt.max_length(), '\0');
-        const FromType *from_next;
-        std::mbstate_t mb = std::mbstate_t();
-        ToType *to_next;
-        codecvt.out(mb, internal.data(), internal.data() + internal.size(), from_next, &external[0], &external[external.size()], to_next);
-        external.resize(to_next - &external[0]);
+        transcode(basic_unistring<FromType> const &internal, std::size_t length, bool ascii, Convert convert) {
+        if(ascii) {
+            return std::basic_string<ToType>(internal.begin(), internal.end());
+        }
+
+        std::basic_string<ToType> external(length, ToType{});
+        auto result = convert(internal.data(), internal.size(), &external[0]);
+        external.resize(result.written);
 
         return external;
     }
+}
 
-    template <typename FromType, typename ToType>
-    std::basic_string<FromType>
-        convertOut(basic_unistring<ToType> const &internal, std::codecvt<FromType, ToType, std::mbstate_t> const &codecvt) {
-        std::basic_string<FromType> external(internal.size() * codecvt.max_length(), '\0');
-        const ToType *from_next;
-        std::mbstate_t mb = std::mbstate_t();
-        FromType *to_next;
-        codecvt.in(mb, internal.data(), internal.data() + internal.size(), from_next, &external[0], &external[external.size()], to_next);
-        external.resize(to_next - &external[0]);
+namespace {
+    /*
+     * Decodes the code point at pos and moves past it, as the conversion to UTF-32 reads it: returns false at the end
+     * of str and at an ill-formed sequence, where that conversion stops. UTF-32 units are taken as they are.
+     */
+    template <typename CharType>
+    bool next_codepoint(CharType const *str, std::size_t length, std::size_t &pos, char32_t &codepoint) {
+        if(pos == length) {
+            return false;
+        } else if(static_cast<std::make_unsigned_t<CharType>>(str[pos]) < 0x80) {
+            codepoint = static_cast<std::make_unsigned_t<CharType>>(str[pos++]);
+            return true;
+        }
 
-        return external;
+        std::size_t const sequence = well_formed_length(str + pos, length - pos);
+        if(sequence == 0) {
+            return false;
+        }
+        codepoint = *unistring_codepoint_iterator<CharType>(str, str + pos, str + length);
+        pos += sequence;
+
+        return true;
+    }
+
+    bool next_codepoint(char32_t const *str, std::size_t length, std::size_t &pos, char32_t &codepoint) {
+        if(pos == length) {
+            return false;
+        }
+        codepoint = str[pos++];
+
+        return true;
+    }
+
+    /*
+     * Returns whether the given buffer only holds whole, well-formed sequences.
+     */
+    bool well_formed(char const *str, std::size_t length) {
+        return unistring_kernels::validate_utf8(str, length);
+    }
+
+    bool well_formed(char16_t const *str, std::size_t length) {
+        for(std::size_t pos = unistring_kernels::length_below(str, length, 0xD800); pos < length;) {
+            std::size_t const sequence = well_formed_length(str + pos, length - pos);
+            if(sequence == 0) {
+                return false;
+            }
+            pos += sequence;
+            pos += unistring_kernels::length_below(str + pos, length - pos, 0xD800);
+        }
+
+        return true;
+    }
+
+    /**
+     * Returns the index of the first unit where two buffers differ, or the length of the shorter one. Blocks of units
+     * are first compared with memcmp, when both use the same encoding.
+     */
+    template <typename CharType>
+    std::size_t mismatch_index(CharType const *lhs, std::size_t lhs_length, CharType const *rhs, std::size_t rhs_length) {
+        std::size_t const length = std::min(lhs_length, rhs_length);
+        std::size_t pos = 0;
+        while(pos + 64 <= length && std::memcmp(lhs + pos, rhs + pos, 64 * sizeof(CharType)) == 0) {
+            pos += 64;
+        }
+
+        return std::mismatch(lhs + pos, lhs + length, rhs + pos).first - lhs;
+    }
+
+    template <typename CharType, typename CharType2>
+    std::size_t mismatch_index(CharType const *lhs, std::size_t lhs_length, CharType2 const *rhs, std::size_t rhs_length) {
+        std::size_t const length = std::min(lhs_length, rhs_length);
+        return std::mismatch(lhs, lhs + length, rhs, [](CharType lhs_unit, CharType2 rhs_unit) {
+                   return static_cast<std::make_unsigned_t<CharType>>(lhs_unit) ==
+                          static_cast<std::make_unsigned_t<CharType2>>(rhs_unit);
+               }).first -
+               lhs;
+    }
+
+    /**
+     * Compares the code points of two buffers from the given positions on, each of them ending at its first ill-formed
+     * sequence.
+     */
+    template <typename CharType, typename CharType2>
+    int compare_codepoints(CharType const *lhs,
+                           std::size_t lhs_length,
+                           std::size_t lhs_pos,
+                           CharType2 const *rhs,
+                           std::size_t rhs_length,
+                           std::size_t rhs_pos) {
+        char32_t lhs_codepoint = 0, rhs_codepoint = 0;
+        while(true) {
+            bool const lhs_left = next_codepoint(lhs, lhs_length, lhs_pos, lhs_codepoint);
+            bool const rhs_left = next_codepoint(rhs, rhs_length, rhs_pos, rhs_codepoint);
+            if(!lhs_left || !rhs_left) {
+                return rhs_left ? -1 : lhs_left;
+            } else if(lhs_codepoint != rhs_codepoint) {
+                return lhs_codepoint < rhs_codepoint ? -1 : 1;
+            }
+        }
+    }
+
+    /*
+     * Buffers of different encodings are decoded from the start, unless either only holds ASCII characters: the units
+     * they have in common are then the same code points.
+     */
+    template <typename CharType, typename CharType2>
+    int compare_buffers(CharType const *lhs, std::size_t lhs_length, CharType2 const *rhs, std::size_t rhs_length) {
+        std::size_t pos = 0;
+        if(unistring_kernels::is_ascii(lhs, lhs_length) || unistring_kernels::is_ascii(rhs, rhs_length)) {
+            pos = mismatch_index(lhs, lhs_length, rhs, rhs_length);
+        }
+
+        return compare_codepoints(lhs, lhs_length, pos, rhs, rhs_length, pos);
+    }
+
+    /*
+     * In the same encoding, identical buffers are equal, ill-formed or not. Others are decoded from the sequence where
+     * they start to differ, provided they are well-formed up to there; otherwise both stop at the same ill-formed
+     * sequence, which decoding them from the start finds.
+     */
+    template <typename CharType>
+    int compare_buffers(CharType const *lhs, std::size_t lhs_length, CharType const *rhs, std::size_t rhs_length) {
+        std::size_t const mismatch = mismatch_index(lhs, lhs_length, rhs, rhs_length);
+        if(mismatch == lhs_length && mismatch == rhs_length) {
+            return 0;
+        }
+        std::size_t const start = std::min(mismatch < lhs_length ? sequence_start(lhs, mismatch) : mismatch,
+                                           mismatch < rhs_length ? sequence_start(rhs, mismatch) : mismatch);
+        std::size_t const pos = well_formed(lhs, start) ? start : 0;
+
+        return compare_codepoints(lhs, lhs_length, pos, rhs, rhs_length, pos);
+    }
+
+    /*
+     * UTF-32 strings are compared unit by unit, as they are.
+     */
+    int compare_buffers(char32_t const *lhs, std::size_t lhs_length, char32_t const *rhs, std::size_t rhs_length) {
+        std::size_t const mismatch = mismatch_index(lhs, lhs_length, rhs, rhs_length);
+        if(mismatch < lhs_length && mismatch < rhs_length) {
+            return lhs[mismatch] < rhs[mismatch] ? -1 : 1;
+        }
+
+        return lhs_length < rhs_length ? -1 : lhs_length > rhs_length;
+    }
+}
+
+template <typename CharType, typename CharType2>
+int unistring_compare(basic_unistring<CharType> const &lhs, basic_unistring<CharType2> const &rhs) {
+    return compare_buffers(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+}
+
+template <typename CharType, typename CharType2>
+bool unistring_equal(basic_unistring<CharType> const &lhs, basic_unistring<CharType2> const &rhs) {
+    return unistring_compare(lhs, rhs) == 0;
+}
+
+/*
+ * FNV-1a, one code point at a time, whose high half is folded into the low one for the buckets of the hash tables.
+ */
+template <typename CharType>
+std::size_t unistring_hash(basic_unistring<CharType> const &str) {
+    std::uint64_t hash = 0xCBF29CE484222325;
+    std::size_t pos = 0;
+    char32_t codepoint;
+    while(next_codepoint(str.data(), str.size(), pos, codepoint)) {
+        hash = (hash ^ codepoint) * 0x100000001B3;
+    }
+
+    return static_cast<std::size_t>(hash ^ (hash >> 32));
+}
+
+#if !UNISTRING_CONSTEXPR_LITERALS
+namespace {
+    bool well_formed(char32_t const *str, std::size_t length) {
+        return std::all_of(str, str + length, [](char32_t unit) { return well_formed_length(&unit, 1) != 0; });
+    }
+
+    /*
+     * Returns the conversion of the given literal, made at its first use. String literals have static storage, so
+     * their address identifies them, and there is one conversion per literal of the program converted at run time:
+     * the storage is bounded by the size of the program. The conversions are kept, and never destroyed, for the
+     * literals may still be used while the program exits.
+     */
+    template <typename ToType, typename FromType>
+    unistring_literal<ToType> interned_literal(FromType const *str, size_t length) {
+        using conversions = std::unordered_map<FromType const *, basic_unistring<ToType> const>;
+        static std::mutex mutex;
+        static conversions *const interned = new conversions;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = interned->find(str);
+        if(it == interned->end()) {
+            if(!well_formed(str, length)) {
+                throw std::invalid_argument("ill-formed literal");
+            }
+            it = interned->emplace(str, basic_unistring<ToType>(basic_unistring<FromType>(str, length))).first;
+        }
+
+        return {it->second.data(), it->second.size()};
     }
 }
 
 namespace unistring_literals {
-    basic_unistring<char> operator""_u8(char const *str, size_t length) {
-        return {str};
+    unistring_literal<char> operator""_u8v(char16_t const *str, size_t length) {
+        return interned_literal<char>(str, length);
     }
 
-    basic_unistring<char16_t> operator""_u16(char const *str, size_t length) {
-        return {str};
+    unistring_literal<char> operator""_u8v(char32_t const *str, size_t length) {
+        return interned_literal<char>(str, length);
     }
 
-    basic_unistring<char32_t> operator""_u32(char const *str, size_t length) {
-        return {str};
+    unistring_literal<char16_t> operator""_u16v(char const *str, size_t length) {
+        return interned_literal<char16_t>(str, length);
+    }
+
+    unistring_literal<char16_t> operator""_u16v(char32_t const *str, size_t length) {
+        return interned_literal<char16_t>(str, length);
+    }
+
+    unistring_literal<char32_t> operator""_u32v(char const *str, size_t length) {
+        return interned_literal<char32_t>(str, length);
+    }
+
+    unistring_literal<char32_t> operator""_u32v(char16_t const *str, size_t length) {
+        return interned_literal<char32_t>(str, length);
     }
 }
+#endif
 
 template class basic_unistring<char>;
 template class basic_unistring<char16_t>;
 template class basic_unistring<char32_t>;
 
+template class unistring_stream_transcoder<char, char16_t>;
+template class unistring_stream_transcoder<char, char32_t>;
+template class unistring_stream_transcoder<char16_t, char>;
+template class unistring_stream_transcoder<char16_t, char32_t>;
+template class unistring_stream_transcoder<char32_t, char>;
+template class unistring_stream_transcoder<char32_t, char16_t>;
+
 template basic_unistring<char>::basic_unistring(basic_unistring<char16_t> const &);
 template basic_unistring<char>::basic_unistring(basic_unistring<char32_t> const &);
 template basic_unistring<char16_t>::basic_unistring(basic_unistring<char> const &);
 template basic_unistring<char16_t>::basic_unistring(basic_unistring<char32_t> const &);
 template basic_unistring<char32_t>::basic_unistring(basic_unistring<char> const &);
 template basic_unistring<char32_t>::basic_unistring(basic_unistring<char16_t> const &);
+
+#define UNISTRING_INSTANTIATE_TRANSCODING(CharType, ToType)                                                   \
+    template unistring_transcode_result basic_unistring<CharType>::transcode_into(ToType *, size_type) const; \
+    template unistring_kernels::conversion_result basic_unistring<CharType>::transcode_prefix(                \
+        size_type, ToType *, size_type) const;
+
+UNISTRING_INSTANTIATE_TRANSCODING(char, char)
+UNISTRING_INSTANTIATE_TRANSCODING(char, char16_t)
+UNISTRING_INSTANTIATE_TRANSCODING(char, char32_t)
+UNISTRING_INSTANTIATE_TRANSCODING(char16_t, char)
+UNISTRING_INSTANTIATE_TRANSCODING(char16_t, char16_t)
+UNISTRING_INSTANTIATE_TRANSCODING(char16_t, char32_t)
+UNISTRING_INSTANTIATE_TRANSCODING(char32_t, char)
+UNISTRING_INSTANTIATE_TRANSCODING(char32_t, char16_t)
+UNISTRING_INSTANTIATE_TRANSCODING(char32_t, char32_t)
+#undef UNISTRING_INSTANTIATE_TRANSCODING
+
+#define UNISTRING_INSTANTIATE_COMPARISON(CharType, CharType2)                                                  \
+    template int unistring_compare(basic_unistring<CharType> const &, basic_unistring<CharType2> const &); \
+    template bool unistring_equal(basic_unistring<CharType> const &, basic_unistring<CharType2> const &);
+
+UNISTRING_INSTANTIATE_COMPARISON(char, char)
+UNISTRING_INSTANTIATE_COMPARISON(char, char16_t)
+UNISTRING_INSTANTIATE_COMPARISON(char, char32_t)
+UNISTRING_INSTANTIATE_COMPARISON(char16_t, char)
+UNISTRING_INSTANTIATE_COMPARISON(char16_t, char16_t)
+UNISTRING_INSTANTIATE_COMPARISON(char16_t, char32_t)
+UNISTRING_INSTANTIATE_COMPARISON(char32_t, char)
+UNISTRING_INSTANTIATE_COMPARISON(char32_t, char16_t)
+UNISTRING_INSTANTIATE_COMPARISON(char32_t, char32_t)
+#undef UNISTRING_INSTANTIATE_COMPARISON
+
+template std::size_t unistring_hash(basic_unistring<char> const &);
+template std::size_t unistring_hash(basic_unistring<char16_t> const &);
+template std::size_t unistring_hash(basic_unistring<char32_t> const &);
@@ -36,10 +36,437 @@
 #include <experimental/type_traits>
 #include <sstream>
 #include <array>
+#include <memory>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include "unistring_kernels.h"
+#include "unistring_normalizer.h"
+#include "utf8proc.h"
 namespace std {
     using namespace std::experimental;
 }
 
+/**
+ * Tag selecting the basic_unistring constructors that check their UTF-8 input for well-formedness.
+ */
+struct unistring_checked_t {};
+constexpr unistring_checked_t unistring_checked{};
+
+/**
+ * Tags selecting the basic_unistring constructors that decode a single-byte buffer, in ISO-8859-1 or Windows-1252.
+ */
+struct unistring_latin1_t {};
+constexpr unistring_latin1_t unistring_latin1{};
+struct unistring_windows1252_t {};
+constexpr unistring_windows1252_t unistring_windows1252{};
+
+/**
+ * Outcome of a conversion into a caller-provided buffer.
+ */
+struct unistring_transcode_result {
+    /**
+     * Number of units written to the buffer. Always a whole number of code points.
+     */
+    size_t written;
+
+    /**
+     * Number of units the whole conversion takes. Exact if the string is well-formed, an upper bound otherwise.
+     */
+    size_t required;
+
+    /**
+     * Whether the buffer was too small to hold the whole conversion.
+     */
+    bool truncated;
+};
+
+/**
+ * Bidirectional iterator over the code points of a UTF-8, UTF-16 or UTF-32 buffer, decoding them in place. An ill-formed
+ * unit reads as U+FFFD and is skipped alone; going backward retraces the code points of a well-formed buffer.
+ */
+template <typename CharType>
+class unistring_codepoint_iterator {
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = char32_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = char32_t const *;
+    using reference = char32_t;
+
+    unistring_codepoint_iterator() = default;
+    unistring_codepoint_iterator(CharType const *begin, CharType const *position, CharType const *end)
+            : first(begin), pos(position), last(end) {
+        this->load();
+    }
+
+    char32_t operator*() const {
+        return codepoint;
+    }
+
+    unistring_codepoint_iterator &operator++() {
+        pos += length;
+        this->load();
+        return *this;
+    }
+    unistring_codepoint_iterator operator++(int) {
+        auto previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    unistring_codepoint_iterator &operator--() {
+        CharType const *start = unistring_codepoint_iterator::decode_previous(first, pos, last, codepoint);
+        length = pos - start;
+        pos = start;
+        return *this;
+    }
+    unistring_codepoint_iterator operator--(int) {
+        auto next = *this;
+        --*this;
+        return next;
+    }
+
+    /**
+     * Returns the position of the current code point in the underlying buffer.
+     */
+    CharType const *base() const {
+        return pos;
+    }
+
+    bool operator==(unistring_codepoint_iterator const &other) const {
+        return pos == other.pos;
+    }
+    bool operator!=(unistring_codepoint_iterator const &other) const {
+        return pos != other.pos;
+    }
+
+private:
+    void load() {
+        if(pos != last) {
+            length = unistring_codepoint_iterator::decode(pos, last, codepoint);
+        }
+    }
+
+    /**
+     * Decodes the code point at the beginning of str, which ends before last, and returns its length. The length of a
+     * UTF-8 sequence comes from the class of its lead byte; its 3 following bytes are then decoded and checked at once,
+     * the tables giving the continuation bytes that belong to it. A sequence that is truncated, overlong or encodes a
+     * surrogate reads as a lone ill-formed byte.
+     */
+    static std::size_t decode(char const *str, char const *last, char32_t &codepoint) {
+        auto bytes = reinterpret_cast<unsigned char const *>(str);
+        std::size_t const length = utf8proc_utf8class[bytes[0]];
+        if(length == 1) {
+            codepoint = bytes[0];
+            return 1;
+        } else if(length == 0 || length > static_cast<std::size_t>(last - str)) {
+            codepoint = 0xFFFD;
+            return 1;
+        }
+
+        unsigned char padded[4] = {};
+        if(last - str < 4) {
+            std::copy(bytes, bytes + (last - str), padded);
+            bytes = padded;
+        }
+        char32_t const payload = ((bytes[1] & 0x3F) << 12) | ((bytes[2] & 0x3F) << 6) | (bytes[3] & 0x3F);
+        char32_t const value = ((bytes[0] & (0x7F >> length)) << (6 * (length - 1))) | (payload >> (6 * (4 - length)));
+        unsigned const misplaced = ((bytes[1] ^ 0x80) | ((bytes[2] ^ 0x80) << 8) | ((bytes[3] ^ 0x80) << 16)) &
+                                   continuation_mask[length];
+        bool const valid =
+            misplaced == 0 && value >= minimum_codepoint[length] && value < 0x110000 && (value & 0xFFFFF800) != 0xD800;
+        codepoint = valid ? value : 0xFFFD;
+
+        return valid ? length : 1;
+    }
+
+    static std::size_t decode(char16_t const *str, char16_t const *last, char32_t &codepoint) {
+        char32_t const unit = str[0];
+        if((unit & 0xF800) != 0xD800) {
+            codepoint = unit;
+            return 1;
+        } else if(unit < 0xDC00 && last - str > 1 && (str[1] & 0xFC00) == 0xDC00) {
+            codepoint = 0x10000 + ((unit - 0xD800) << 10) + (str[1] - 0xDC00);
+            return 2;
+        }
+
+        codepoint = 0xFFFD;
+        return 1;
+    }
+
+    static std::size_t decode(char32_t const *str, char32_t const *, char32_t &codepoint) {
+        codepoint = str[0] < 0x110000 && (str[0] & 0xFFFFF800) != 0xD800 ? str[0] : 0xFFFD;
+        return 1;
+    }
+
+    /**
+     * Decodes the code point ending at pos, in a buffer ending at last, and returns its start. In UTF-8, that is the
+     * lead byte found within 3 continuation bytes back, provided its sequence ends at pos; otherwise the last byte
+     * stands alone.
+     */
+    static char const *decode_previous(char const *first, char const *pos, char const *last, char32_t &codepoint) {
+        char const *lead = pos - 1;
+        if(static_cast<unsigned char>(*lead) < 0x80) {
+            codepoint = static_cast<unsigned char>(*lead);
+            return lead;
+        }
+        while(lead > first && pos - lead < 4 && (*lead & 0xC0) == 0x80) {
+            --lead;
+        }
+        if(unistring_codepoint_iterator::decode(lead, last, codepoint) == static_cast<std::size_t>(pos - lead)) {
+            return lead;
+        }
+        codepoint = 0xFFFD;
+
+        return pos - 1;
+    }
+
+    static char16_t const *decode_previous(char16_t const *first, char16_t const *pos, char16_t const *, char32_t &codepoint) {
+        bool const pair = pos - first > 1 && (pos[-1] & 0xFC00) == 0xDC00 && (pos[-2] & 0xFC00) == 0xD800;
+        char16_t const *start = pair ? pos - 2 : pos - 1;
+        unistring_codepoint_iterator::decode(start, pos, codepoint);
+
+        return start;
+    }
+
+    static char32_t const *decode_previous(char32_t const *, char32_t const *pos, char32_t const *, char32_t &codepoint) {
+        unistring_codepoint_iterator::decode(pos - 1, pos, codepoint);
+        return pos - 1;
+    }
+
+    /**
+     * Bits of the 3 bytes following a UTF-8 lead that must be those of continuation bytes, and smallest code point,
+     * below which the sequence is overlong, for each sequence length.
+     */
+    static constexpr unsigned continuation_mask[5] = {0, 0, 0xC0, 0xC0C0, 0xC0C0C0};
+    static constexpr char32_t minimum_codepoint[5] = {0, 0, 0x80, 0x800, 0x10000};
+
+    CharType const *first = nullptr;
+    CharType const *pos = nullptr;
+    CharType const *last = nullptr;
+    char32_t codepoint = 0;
+    std::size_t length = 0;
+};
+
+template <typename CharType>
+constexpr unsigned unistring_codepoint_iterator<CharType>::continuation_mask[];
+template <typename CharType>
+constexpr char32_t unistring_codepoint_iterator<CharType>::minimum_codepoint[];
+
+/**
+ * Range of the code points of a buffer, valid as long as the buffer is left unmodified.
+ */
+template <typename CharType>
+class unistring_codepoint_range {
+public:
+    using iterator = unistring_codepoint_iterator<CharType>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    unistring_codepoint_range(CharType const *str, size_t length) : first(str), last(str + length) {}
+
+    iterator begin() const {
+        return {first, first, last};
+    }
+    iterator end() const {
+        return {first, last, last};
+    }
+
+    reverse_iterator rbegin() const {
+        return reverse_iterator(this->end());
+    }
+    reverse_iterator rend() const {
+        return reverse_iterator(this->begin());
+    }
+
+    CharType const *data() const {
+        return first;
+    }
+    size_t size() const {
+        return last - first;
+    }
+
+private:
+    CharType const *first;
+    CharType const *last;
+};
+
+/**
+ * Bidirectional iterator over the extended grapheme clusters of a buffer, as utf8proc_grapheme_break tells them apart.
+ * Each cluster reads as the range of its code points, which are decoded in place; that rule only depending on the
+ * boundclass of the code points on either side of a boundary, each code point is looked up once, and a pair of ASCII
+ * characters other than CR LF is split without any lookup.
+ */
+template <typename CharType>
+class unistring_grapheme_iterator {
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = unistring_codepoint_range<CharType>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type const *;
+    using reference = value_type;
+
+    unistring_grapheme_iterator() = default;
+    unistring_grapheme_iterator(CharType const *begin, CharType const *position, CharType const *end)
+            : first(begin), pos(position), last(end), next(begin, position, end) {
+        this->find_next();
+    }
+
+    value_type operator*() const {
+        return {pos, static_cast<size_t>(next.base() - pos)};
+    }
+
+    unistring_grapheme_iterator &operator++() {
+        pos = next.base();
+        this->find_next();
+        return *this;
+    }
+    unistring_grapheme_iterator operator++(int) {
+        auto previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    unistring_grapheme_iterator &operator--() {
+        unistring_codepoint_iterator<CharType> start(first, pos, last);
+        --start;
+        auto const &table = unistring_grapheme_iterator::break_table();
+        int following = unistring_grapheme_iterator::boundclass(*start);
+        while(start.base() != first) {
+            auto before = start;
+            --before;
+            int const previous = unistring_grapheme_iterator::boundclass(*before);
+            if((table[previous] >> following) & 1) {
+                break;
+            }
+            following = previous;
+            start = before;
+        }
+        next = unistring_codepoint_iterator<CharType>(first, pos, last);
+        next_class = -1;
+        pos = start.base();
+        return *this;
+    }
+    unistring_grapheme_iterator operator--(int) {
+        auto following = *this;
+        --*this;
+        return following;
+    }
+
+    /**
+     * Returns the position of the current cluster in the underlying buffer.
+     */
+    CharType const *base() const {
+        return pos;
+    }
+
+    bool operator==(unistring_grapheme_iterator const &other) const {
+        return pos == other.pos;
+    }
+    bool operator!=(unistring_grapheme_iterator const &other) const {
+        return pos != other.pos;
+    }
+
+private:
+    /**
+     * Moves next, which stands on the first code point of the current cluster, to the first one of the following
+     * cluster.
+     */
+    void find_next() {
+        if(pos == last) {
+            return;
+        }
+
+        char32_t const codepoint = *next;
+        ++next;
+        if(next.base() == last || (codepoint < 0x80 && codepoint != '\r' && *next < 0x80)) {
+            next_class = -1;
+            return;
+        }
+        auto const &table = unistring_grapheme_iterator::break_table();
+        int previous = next_class >= 0 ? next_class : unistring_grapheme_iterator::boundclass(codepoint);
+        next_class = -1;
+        for(; next.base() != last; ++next) {
+            int const following = unistring_grapheme_iterator::boundclass(*next);
+            if((table[previous] >> following) & 1) {
+                next_class = following;
+                break;
+            }
+            previous = following;
+        }
+    }
+
+    static int boundclass(char32_t codepoint) {
+        return utf8proc_get_property(codepoint)->boundclass;
+    }
+
+    /**
+     * Returns, for each boundclass, the bit set of the boundclasses that start a new cluster when they follow it. The
+     * rules are gathered once from utf8proc_grapheme_break.
+     */
+    static std::array<unsigned, 16> const &break_table() {
+        static std::array<unsigned, 16> const table = [] {
+            // A code point of each boundclass.
+            char32_t const representatives[] = {'a', '\r', '\n', 0x1, 0x300, 0x1100,
+                                                0x1160, 0x11A8, 0xAC00, 0xAC01, 0x1F1E6, 0x903};
+            std::array<unsigned, 16> breaking{};
+            for(char32_t before : representatives) {
+                for(char32_t after : representatives) {
+                    if(utf8proc_grapheme_break(before, after)) {
+                        breaking[boundclass(before)] |= 1u << boundclass(after);
+                    }
+                }
+            }
+            return breaking;
+        }();
+
+        return table;
+    }
+
+    CharType const *first = nullptr;
+    CharType const *pos = nullptr;
+    CharType const *last = nullptr;
+
+    /**
+     * First code point of the following cluster, and its boundclass once looked up, -1 before.
+     */
+    unistring_codepoint_iterator<CharType> next;
+    int next_class = -1;
+};
+
+/**
+ * Range of the extended grapheme clusters of a buffer, valid as long as the buffer is left unmodified.
+ */
+template <typename CharType>
+class unistring_grapheme_range {
+public:
+    using iterator = unistring_grapheme_iterator<CharType>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    unistring_grapheme_range(CharType const *str, size_t length) : first(str), last(str + length) {}
+
+    iterator begin() const {
+        return {first, first, last};
+    }
+    iterator end() const {
+        return {first, last, last};
+    }
+
+    reverse_iterator rbegin() const {
+        return reverse_iterator(this->end());
+    }
+    reverse_iterator rend() const {
+        return reverse_iterator(this->begin());
+    }
+
+private:
+    CharType const *first;
+    CharType const *last;
+};
+
+template <typename CharType>
+class unistring_literal;
+
 template <typename CharType, typename _T = std::enable_if_t<std::is_same_v<CharType, char> || std::is_same_v<CharType, char16_t> || std::is_same_v<CharType, char32_t>>>
 class basic_unistring : private std::basic_string<CharType> {
     using base_type = std::basic_string<CharType>;
@@ -78,6 +505,28 @@ public:
 
     basic_unistring() {}
 
+    /*
+     * A copy leaves the offset index behind and builds its own when first asked for it, so that copying never
+     * touches the index that const members of other may be building meanwhile.
+     */
+    basic_unistring(basic_unistring const &other) : base_type(other), flags(other.flags) {}
+    basic_unistring(basic_unistring &&other) noexcept
+            : base_type(std::move(other)), offset_index(std::move(other.offset_index)), flags(other.flags) {}
+
+    basic_unistring &operator=(basic_unistring const &other) {
+        basic_unistring tmp(other);
+        this->swap(tmp);
+
+        return *this;
+    }
+    basic_unistring &operator=(basic_unistring &&other) noexcept {
+        base_type::operator=(std::move(other));
+        offset_index = std::move(other.offset_index);
+        flags = other.flags;
+
+        return *this;
+    }
+
     basic_unistring(basic_unistring const &other, size_type pos, size_type count = basic_unistring::npos) {
         auto first = other.begin() + pos, last = other.end();
         if(count != basic_unistring::npos) {
@@ -85,6 +534,9 @@ public:
         }
 
         *this = basic_unistring(first, last);
+        if(other.flags & known_ascii) {
+            flags = ascii_flags;
+        }
     }
 
     /**
@@ -110,6 +562,31 @@ public:
     basic_unistring(std::basic_string<CharType2> const &str)
             : basic_unistring<CharType>(basic_unistring<CharType2>(str)) {}
 
+    /**
+     * Constructs the basic_unistring object from the given unistring_literals literal, performing the necessary
+     * conversion.
+     */
+    template <typename CharType2>
+    basic_unistring(unistring_literal<CharType2> const &literal);
+
+    /**
+     * Constructs the basic_unistring object from the given UTF-8 buffer, performing the necessary conversion.
+     * Throws std::invalid_argument if the buffer is not well-formed UTF-8.
+     */
+    basic_unistring(unistring_checked_t, char const *str, size_type length);
+    basic_unistring(unistring_checked_t, std::string const &str)
+            : basic_unistring(unistring_checked, str.data(), str.size()) {}
+
+    /**
+     * Constructs the basic_unistring object from the given ISO-8859-1 or Windows-1252 buffer. Every byte is a
+     * character, so these never fail.
+     */
+    basic_unistring(unistring_latin1_t, char const *str, size_type length);
+    basic_unistring(unistring_latin1_t, std::string const &str) : basic_unistring(unistring_latin1, str.data(), str.size()) {}
+    basic_unistring(unistring_windows1252_t, char const *str, size_type length);
+    basic_unistring(unistring_windows1252_t, std::string const &str)
+            : basic_unistring(unistring_windows1252, str.data(), str.size()) {}
+
     template <typename T>
     basic_unistring &operator=(T const &value) {
         using std::swap;
@@ -123,17 +600,59 @@ public:
         return *this = value;
     }
 
-    using base_type::begin;
-    using base_type::end;
+    /*
+     * Any non-const access may modify the string, and so drops the code point offset index and what is known of the
+     * contents, even when it only reads: read through cbegin(), cend() or a const reference to keep them. A pointer,
+     * iterator or reference obtained from a non-const member is not tracked afterwards, so after writing through it
+     * once a const member has been called, call a non-const member such as begin() again before the next query.
+     */
+    iterator begin() {
+        this->drop_derived_state();
+        return base_type::begin();
+    }
+    const_iterator begin() const {
+        return base_type::begin();
+    }
+    iterator end() {
+        this->drop_derived_state();
+        return base_type::end();
+    }
+    const_iterator end() const {
+        return base_type::end();
+    }
+    reverse_iterator rbegin() {
+        this->drop_derived_state();
+        return base_type::rbegin();
+    }
+    const_reverse_iterator rbegin() const {
+        return base_type::rbegin();
+    }
+    reverse_iterator rend() {
+        this->drop_derived_state();
+        return base_type::rend();
+    }
+    const_reverse_iterator rend() const {
+        return base_type::rend();
+    }
     using base_type::cbegin;
     using base_type::cend;
-    using base_type::rbegin;
-    using base_type::rend;
     using base_type::crbegin;
     using base_type::crend;
 
-    using base_type::front;
-    using base_type::back;
+    reference front() {
+        this->drop_derived_state();
+        return base_type::front();
+    }
+    const_reference front() const {
+        return base_type::front();
+    }
+    reference back() {
+        this->drop_derived_state();
+        return base_type::back();
+    }
+    const_reference back() const {
+        return base_type::back();
+    }
 
     template <typename T>
     basic_unistring &append(T const &value) {
@@ -143,55 +662,176 @@ public:
     template <typename T>
     basic_unistring &operator+=(T const &value) {
         basic_unistring tmp(value);
+        unsigned char const joined = this->concatenation_flags(tmp);
+        this->drop_derived_state();
         this->basic_string::operator+=(tmp);
+        flags = joined;
         return *this;
     }
 
-    using base_type::at;
-    using base_type::operator[];
+    reference at(size_type pos) {
+        this->drop_derived_state();
+        return base_type::at(pos);
+    }
+    const_reference at(size_type pos) const {
+        return base_type::at(pos);
+    }
+
+    reference operator[](size_type pos) {
+        this->drop_derived_state();
+        return base_type::operator[](pos);
+    }
+    const_reference operator[](size_type pos) const {
+        return base_type::operator[](pos);
+    }
 
     using base_type::c_str;
-    using base_type::data;
+
+    CharType *data() {
+        this->drop_derived_state();
+        return base_type::data();
+    }
+    CharType const *data() const {
+        return base_type::data();
+    }
 
     using base_type::size;
     using base_type::length;
     using base_type::empty;
 
+    /**
+     * Returns the number of code points of the string, counted in place. Exact if the string is well-formed, an upper
+     * bound otherwise.
+     */
+    size_type codepoint_count() const;
+
+    /**
+     * Returns the position of the code point that comes count code points after the one at pos, or size() if the
+     * string ends before. pos must be the position of a code point; throws std::out_of_range if it is past the end.
+     */
+    size_type advance_codepoints(size_type pos, size_type count) const;
+
+    /**
+     * Returns the range of the code points of the string, decoded in place as they are visited. It is invalidated
+     * like the iterators of the string.
+     */
+    unistring_codepoint_range<CharType> codepoints() const {
+        return {this->data(), this->size()};
+    }
+
+    /**
+     * Returns the position of the code point of the given index, or size() for codepoint_count(). Throws
+     * std::out_of_range if index is greater.
+     *
+     * The code point indexed accessors rely on an index of the position of every 64th code point, built on first use
+     * and dropped when the string is modified, so that they only skip a few code points.
+     */
+    size_type codepoint_offset(size_type index) const;
+
+    /**
+     * Returns the index of the code point at the given position, which must be that of a code point or size().
+     * Throws std::out_of_range if pos is past the end.
+     */
+    size_type codepoint_index(size_type pos) const;
+
+    /**
+     * Returns the code point of the given index, or U+FFFD if it is ill-formed. Throws std::out_of_range if index is
+     * not less than codepoint_count().
+     */
+    char32_t codepoint_at(size_type index) const;
+
+    /**
+     * Code point indexed counterparts of substr and replace: count code points starting at the one of the given index,
+     * fewer if the string ends before.
+     */
+    basic_unistring codepoint_substr(size_type index, size_type count = npos) const;
+    basic_unistring &codepoint_replace(size_type index, size_type count, basic_unistring const &value);
+
+    /**
+     * Returns the range of the extended grapheme clusters of the string, told apart in place as they are visited. It
+     * is invalidated like the iterators of the string.
+     */
+    unistring_grapheme_range<CharType> graphemes() const {
+        return {this->data(), this->size()};
+    }
+
+    /**
+     * Grapheme cluster counterpart of substr: count clusters starting at the one of the given index, fewer if the
+     * string ends before. Throws std::out_of_range if the string has fewer than index clusters.
+     */
+    basic_unistring substr_graphemes(size_type index, size_type count = npos) const;
+
+    /**
+     * Keeps the first count grapheme clusters of the string, all of them if it has fewer. Like substr_graphemes, it
+     * walks the cluster boundaries once, up to the last cluster kept.
+     */
+    basic_unistring &truncate_graphemes(size_type count);
+
     using base_type::capacity;
     using base_type::reserve;
     using base_type::max_size;
     using base_type::shrink_to_fit;
 
-    using base_type::clear;
-    using base_type::insert;
-    using base_type::erase;
-    using base_type::push_back;
-    using base_type::pop_back;
+    void clear() {
+        this->drop_derived_state();
+        base_type::clear();
+    }
+
+    template <typename... Args>
+    decltype(auto) insert(Args &&... args) {
+        this->drop_derived_state();
+        return base_type::insert(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    decltype(auto) erase(Args &&... args) {
+        this->drop_derived_state();
+        return base_type::erase(std::forward<Args>(args)...);
+    }
+
+    void push_back(CharType value) {
+        this->drop_derived_state();
+        base_type::push_back(value);
+    }
+
+    void pop_back() {
+        this->drop_derived_state();
+        base_type::pop_back();
+    }
 
     using base_type::compare;
-    using base_type::replace;
+
+    template <typename... Args>
+    decltype(auto) replace(Args &&... args) {
+        this->drop_derived_state();
+        return base_type::replace(std::forward<Args>(args)...);
+    }
 
     template <typename InputIt>
     std::enable_if_t<std::is_convertible_v<typename InputIt::iterator_category, std::input_iterator_tag>, basic_unistring &>
         replace(InputIt it1, InputIt it2, basic_unistring<CharType> const &value) {
+        this->drop_derived_state();
         this->basic_string::replace(it1, it2, value.begin(), value.end());
         return *this;
     }
     template <typename InputIt>
     std::enable_if_t<std::is_convertible_v<typename InputIt::iterator_category, std::input_iterator_tag>, basic_unistring &>
         replace(InputIt it1, InputIt it2, std::basic_string<CharType> const &value) {
+        this->drop_derived_state();
         this->basic_string::replace(it1, it2, value.begin(), value.end());
         return *this;
     }
     template <typename InputIt>
     std::enable_if_t<std::is_convertible_v<typename InputIt::iterator_category, std::input_iterator_tag>, basic_unistring &>
         replace(InputIt it1, InputIt it2, CharType const *value) {
+        this->drop_derived_state();
         this->basic_string::replace(it1, it2, value);
         return *this;
     }
     template <typename InputIt>
     std::enable_if_t<std::is_convertible_v<typename InputIt::iterator_category, std::input_iterator_tag>, basic_unistring &>
         replace(InputIt it1, InputIt it2, size_type count, CharType value) {
+        this->drop_derived_state();
         this->basic_string::replace(it1, it2, count, value);
         return *this;
     }
@@ -217,8 +857,18 @@ public:
         return basic_unistring(*this, pos, n);
     }
     using base_type::copy;
-    using base_type::resize;
-    using base_type::swap;
+
+    template <typename... Args>
+    void resize(Args &&... args) {
+        this->drop_derived_state();
+        base_type::resize(std::forward<Args>(args)...);
+    }
+
+    void swap(basic_unistring &other) {
+        base_type::swap(other);
+        offset_index.swap(other.offset_index);
+        std::swap(flags, other.flags);
+    }
 
     using base_type::find;
     using base_type::rfind;
@@ -242,6 +892,48 @@ public:
         return {begin(), end()};
     }
 
+    /**
+     * Converts the string into the given buffer, writing at most capacity units. When the buffer is too small, only the
+     * code points that fit whole are written and the result is marked as truncated.
+     */
+    unistring_transcode_result to_utf8(char *out, size_type capacity) const {
+        return this->transcode_into(out, capacity);
+    }
+
+    unistring_transcode_result to_utf16(char16_t *out, size_type capacity) const {
+        return this->transcode_into(out, capacity);
+    }
+
+    unistring_transcode_result to_utf32(char32_t *out, size_type capacity) const {
+        return this->transcode_into(out, capacity);
+    }
+
+    /**
+     * Converts the string to the given output iterator, going through a fixed-size buffer instead of an intermediate
+     * string. Returns the iterator past the last unit written.
+     */
+    template <typename OutputIt>
+    OutputIt to_utf8(OutputIt out) const {
+        return this->transcode_to<char>(out);
+    }
+
+    template <typename OutputIt>
+    OutputIt to_utf16(OutputIt out) const {
+        return this->transcode_to<char16_t>(out);
+    }
+
+    template <typename OutputIt>
+    OutputIt to_utf32(OutputIt out) const {
+        return this->transcode_to<char32_t>(out);
+    }
+
+    /**
+     * Converts the string to ISO-8859-1 or Windows-1252, the characters the encoding lacks being replaced by '?'. Like
+     * the other conversions, stops at the first ill-formed sequence.
+     */
+    std::string to_latin1() const;
+    std::string to_windows1252() const;
+
     operator std::string() const {
         return to_utf8();
     }
@@ -254,11 +946,87 @@ public:
         return to_utf32();
     }
 
-    void normalize() {
-        *this = this->get_normalized();
+    /**
+     * Returns whether the string is in the given normalization form; an ill-formed string is not. The quick check of
+     * UAX#15 settles most strings in a single pass, skipping the units below the first code point the form may alter
+     * in bulk; the rest are normalized and compared.
+     */
+    bool is_normalized(unistring_normalization_form form = unistring_normalization_form::nfc) const;
+
+    /**
+     * Normalizes the string to the given form, in place. A string the quick check finds in that form is left as is;
+     * otherwise the normalization goes through scratch storage of the thread and is copied back, so that once both
+     * are large enough it allocates nothing. The scratch storage is released after strings of more than 64 Ki units,
+     * which keeps a thread from holding on to the size of the largest string it ever normalized. Throws
+     * std::invalid_argument if the string is ill-formed.
+     *
+     * The string then remembers it is in that form, as do its copies and the concatenations of such strings whose
+     * boundary needs no normalization, until they are otherwise modified: normalizing them again, or checking them
+     * with is_normalized, costs nothing.
+     */
+    void normalize(unistring_normalization_form form = unistring_normalization_form::nfc);
+
+    /**
+     * Returns the given normalization of the string: the string itself if the quick check finds it in that form,
+     * moved from if it is an rvalue.
+     */
+    basic_unistring get_normalized(unistring_normalization_form form = unistring_normalization_form::nfc) const & {
+        basic_unistring result = this->passes_quick_check(form) ? *this : this->normalized(form);
+        result.flags |= form_flag(form);
+        return result;
+    }
+    basic_unistring get_normalized(unistring_normalization_form form = unistring_normalization_form::nfc) && {
+        basic_unistring result = this->passes_quick_check(form) ? std::move(*this) : this->normalized(form);
+        result.flags |= form_flag(form);
+        return result;
+    }
+
+    /**
+     * Appends the given string to this one and normalizes the result to the given form. Only the text from the last
+     * stable code point of the string on is normalized again along with the appended one, so that building a
+     * normalized text costs in proportion to what is appended. The string is normalized whole along with the appended
+     * one unless it is known or quickly checked to be in that form. What is normalized goes through scratch storage of
+     * the thread, released past 64 Ki units as with normalize, and only replaces the string once done: throws
+     * std::invalid_argument, leaving the string as it was, if either is ill-formed.
+     */
+    basic_unistring &append_normalized(basic_unistring const &value,
+                                       unistring_normalization_form form = unistring_normalization_form::nfc);
+    template <typename T>
+    basic_unistring &append_normalized(T const &value,
+                                       unistring_normalization_form form = unistring_normalization_form::nfc) {
+        return this->append_normalized(basic_unistring(value), form);
     }
 
-    basic_unistring get_normalized() const;
+    /**
+     * Returns the normalization of the string to the form of the given cache, through it. Throws
+     * std::invalid_argument if the string is ill-formed.
+     */
+    basic_unistring get_normalized(unistring_normalization_cache<CharType> &cache) const;
+
+    /**
+     * Same as get_normalized, the normalization running on the given number of threads, the hardware concurrency by
+     * default, as unistring_normalizer::normalize_parallel does it. Meant for large documents.
+     */
+    basic_unistring get_normalized_parallel(unistring_normalization_form form = unistring_normalization_form::nfc,
+                                            unsigned threads = 0) const;
+
+    /**
+     * Normalizes the strings of the range [first, last) to the given form, in place. One normalizer and one scratch
+     * string serve the whole batch, so that past its first strings only those whose normalization outgrows their own
+     * capacity allocate. Throws std::invalid_argument at the first ill-formed string, those before being normalized.
+     */
+    template <typename ForwardIt>
+    static void normalize(ForwardIt first, ForwardIt last,
+                          unistring_normalization_form form = unistring_normalization_form::nfc);
+
+    /**
+     * Writes the given normalization of each string of the range [first, last) to out and returns the end of the
+     * output range. The batch shares its normalizer and scratch string as with normalize, each output string being
+     * allocated once, at its size.
+     */
+    template <typename InputIt, typename OutputIt>
+    static OutputIt normalize_copy(InputIt first, InputIt last, OutputIt out,
+                                   unistring_normalization_form form = unistring_normalization_form::nfc);
 
     template <template <typename...> class Container = std::vector>
     Container<basic_unistring> split(CharType separator) const {
@@ -294,8 +1062,94 @@ public:
     basic_unistring &append_format(basic_unistring format, Args &&... args);
 
 private:
+    template <typename, typename>
+    friend class basic_unistring;
+
+    struct codepoint_offset_index;
+
+    /**
+     * Index of the code point positions, built by the first const member needing it. Const members may build it
+     * concurrently, so they access it atomically; the non-const ones, which may not run concurrently with any other
+     * member, do not.
+     */
+    mutable std::shared_ptr<codepoint_offset_index const> offset_index;
+
+    std::shared_ptr<codepoint_offset_index const> get_offset_index() const;
+
+    /**
+     * What is known of the contents of the string: a bit per normalization form it is in, and whether it is ASCII,
+     * which puts it in every form but NFKC_Casefold. Set as the string is normalized or validated, kept by copies and
+     * cleared by modifications.
+     */
+    unsigned char flags = 0;
+
+    static constexpr unsigned char known_ascii = 1 << 5;
+    static constexpr unsigned char ascii_flags = known_ascii | 0xF;
+
+    static constexpr unsigned char form_flag(unistring_normalization_form form) {
+        return static_cast<unsigned char>(1 << static_cast<int>(form));
+    }
+
+    void drop_derived_state() {
+        if(offset_index) {
+            offset_index.reset();
+        }
+        flags = 0;
+    }
+
+    /**
+     * Returns the flags that hold for the string followed by other: the forms both are in when other starts at a
+     * boundary of that form, and ASCII when both are.
+     */
+    unsigned char concatenation_flags(basic_unistring const &other) const;
+
+    /**
+     * Sets the known ASCII flags if the string is ASCII, for the constructors that validate their input.
+     */
+    void check_ascii();
+
+    /**
+     * Replaces the string with its normalization to the given form, held by scratch, and marks it as such.
+     */
+    void assign_normalized(base_type const &scratch, unistring_normalization_form form);
+
+    /**
+     * Returns the position of the grapheme cluster that comes count clusters after the one at pos, size() if the
+     * string ends right after them, npos if it ends before.
+     */
+    size_type advance_graphemes(size_type pos, size_type count) const;
+
+    /**
+     * Returns whether the quick check answers yes for the given form, which leaves out the strings that may be in it.
+     */
+    bool passes_quick_check(unistring_normalization_form form) const;
+
+    /**
+     * Returns the given normalization of the string. Throws std::invalid_argument if the string is ill-formed.
+     */
+    basic_unistring normalized(unistring_normalization_form form) const;
+
+    /**
+     * Writes the normalization of the string with the given normalizer to scratch, which is cleared first, unless
+     * the quick check finds the string normalized. Returns whether scratch holds the normalization. Throws
+     * std::invalid_argument if the string is ill-formed.
+     */
+    bool normalize_into(unistring_normalizer &normalizer, base_type &scratch) const;
+
     static void map_arguments(std::vector<basic_unistring> &vect) {}
 
+    template <typename ToType>
+    unistring_transcode_result transcode_into(ToType *out, size_type capacity) const;
+
+    /**
+     * Converts the longest run of whole code points starting at pos whose conversion fits in capacity units.
+     */
+    template <typename ToType>
+    unistring_kernels::conversion_result transcode_prefix(size_type pos, ToType *out, size_type capacity) const;
+
+    template <typename ToType, typename OutputIt>
+    OutputIt transcode_to(OutputIt out) const;
+
     template <typename Arg, typename... Args>
     static void map_arguments(std::vector<basic_unistring> &vect, Arg &&arg, Args &&... args);
 };
@@ -317,6 +1171,53 @@ Container<basic_unistring<CharType, T>> basic_unistring<CharType, T>::split(basi
     return container;
 }
 
+template <typename CharType, typename T>
+template <typename ForwardIt>
+void basic_unistring<CharType, T>::normalize(ForwardIt first, ForwardIt last, unistring_normalization_form form) {
+    unistring_normalizer normalizer(form);
+    base_type scratch;
+    for(; first != last; ++first) {
+        basic_unistring &str = *first;
+        if(str.normalize_into(normalizer, scratch)) {
+            str.assign_normalized(scratch, form);
+        } else {
+            str.flags |= form_flag(form);
+        }
+    }
+}
+
+template <typename CharType, typename T>
+template <typename InputIt, typename OutputIt>
+OutputIt basic_unistring<CharType, T>::normalize_copy(InputIt first, InputIt last, OutputIt out,
+                                                      unistring_normalization_form form) {
+    unistring_normalizer normalizer(form);
+    base_type scratch;
+    for(; first != last; ++first, ++out) {
+        basic_unistring const &str = *first;
+        basic_unistring normalized = str.normalize_into(normalizer, scratch) ? basic_unistring(scratch) : str;
+        normalized.flags |= form_flag(form);
+        *out = std::move(normalized);
+    }
+
+    return out;
+}
+
+template <typename CharType, typename T>
+template <typename ToType, typename OutputIt>
+OutputIt basic_unistring<CharType, T>::transcode_to(OutputIt out) const {
+    std::array<ToType, 256> buffer;
+    for(size_type pos = 0; pos < this->size();) {
+        auto result = this->transcode_prefix(pos, buffer.data(), buffer.size());
+        if(result.read == 0) {
+            break;
+        }
+        out = std::copy_n(buffer.data(), result.written, out);
+        pos += result.read;
+    }
+
+    return out;
+}
+
 template <typename CharType, typename T>
 template <typename Arg, typename... Args>
 void basic_unistring<CharType, T>::map_arguments(std::vector<basic_unistring> &vect, Arg &&arg, Args &&... args) {
@@ -363,16 +1264,426 @@ basic_unistring<CharType, T> &basic_unistring<CharType, T>::append_format(basic_
     return *this;
 }
 
+/**
+ * Returns whether the given buffer is well-formed UTF-8.
+ */
+inline bool is_valid_utf8(char const *str, size_t length) {
+    return unistring_kernels::validate_utf8(str, length);
+}
+
+inline bool is_valid_utf8(std::string const &str) {
+    return is_valid_utf8(str.data(), str.size());
+}
+
+inline bool is_valid_utf8(basic_unistring<char> const &str) {
+    return is_valid_utf8(str.data(), str.size());
+}
+
+/**
+ * Converts a text received in chunks from one encoding to another. Sequences split across chunks are kept until the
+ * chunk completing them is fed, so that memory use does not depend on the size of the whole text.
+ */
+template <typename FromType, typename ToType>
+class unistring_stream_transcoder {
+public:
+    /**
+     * Converts the given chunk and appends the result to out. Returns false if the text is ill-formed, in which case
+     * out holds the conversion up to the error and the following calls fail until reset() is called.
+     */
+    bool feed(FromType const *str, size_t length, std::basic_string<ToType> &out);
+    bool feed(std::basic_string<FromType> const &str, std::basic_string<ToType> &out) {
+        return this->feed(str.data(), str.size(), out);
+    }
+
+    /**
+     * Ends the text and resets the transcoder. Returns false if the text ended in the middle of a sequence or if a
+     * previous chunk was ill-formed.
+     */
+    bool finish();
+
+    void reset() {
+        carry_length = 0;
+        failed = false;
+    }
+
+private:
+    std::array<FromType, 4> carry;
+    size_t carry_length = 0;
+    bool failed = false;
+};
+
+/**
+ * String literal of the _u8v, _u16v and _u32v operators, which refers to the static storage holding it in its encoding
+ * without owning it, and so costs nothing to create or copy. It converts to the range of its code points, which
+ * does not allocate either, and to a basic_unistring of any encoding, which copies it. It can be streamed,
+ * concatenated and compared like a basic_unistring; the other members of basic_unistring need the conversion to be
+ * spelled out.
+ */
+template <typename CharType>
+class unistring_literal {
+public:
+    using value_type = CharType;
+    using size_type = size_t;
+    using const_iterator = CharType const *;
+
+    constexpr unistring_literal(CharType const *str, size_type length) : str(str), length(length) {}
+
+    constexpr CharType const *data() const {
+        return str;
+    }
+    constexpr size_type size() const {
+        return length;
+    }
+    constexpr bool empty() const {
+        return length == 0;
+    }
+
+    constexpr const_iterator begin() const {
+        return str;
+    }
+    constexpr const_iterator end() const {
+        return str + length;
+    }
+
+    constexpr CharType operator[](size_type pos) const {
+        return str[pos];
+    }
+
+    unistring_codepoint_range<CharType> codepoints() const {
+        return {str, length};
+    }
+
+    operator unistring_codepoint_range<CharType>() const {
+        return this->codepoints();
+    }
+
+private:
+    CharType const *str;
+    size_type length;
+};
+
+template <typename CharType, typename T>
+template <typename CharType2>
+basic_unistring<CharType, T>::basic_unistring(unistring_literal<CharType2> const &literal)
+        : basic_unistring(basic_unistring<CharType2>(literal.data(), literal.size())) {}
+
+/**
+ * Fixed-size array of units, which unlike a built-in array can be returned by the constexpr functions below.
+ */
+template <typename CharType, size_t Size>
+struct unistring_literal_units {
+    CharType units[Size];
+};
+
+/**
+ * Compile-time conversion of string literals between UTF-8, UTF-16 and UTF-32. An ill-formed literal throws, which
+ * is not allowed in a constant expression and so fails to compile.
+ */
+struct unistring_literal_codec {
+    /**
+     * Decodes the code point at pos in the given buffer of length units, and moves pos past it.
+     */
+    static constexpr char32_t decode(char const *str, size_t length, size_t &pos) {
+        unsigned const lead = static_cast<unsigned char>(str[pos]);
+        size_t const count = lead < 0x80 ? 1 : lead < 0xC2 ? 0 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : lead < 0xF5 ? 4 : 0;
+        if(count == 0 || length - pos < count) {
+            throw std::invalid_argument("ill-formed UTF-8 literal");
+        }
+        char32_t codepoint = count == 1 ? lead : lead & (0x7F >> count);
+        for(size_t i = 1; i < count; ++i) {
+            unsigned const unit = static_cast<unsigned char>(str[pos + i]);
+            if((unit & 0xC0) != 0x80) {
+                throw std::invalid_argument("ill-formed UTF-8 literal");
+            }
+            codepoint = (codepoint << 6) | (unit & 0x3F);
+        }
+        char32_t const minimum = count == 2 ? 0x80 : count == 3 ? 0x800 : count == 4 ? 0x10000 : 0;
+        if(codepoint < minimum || codepoint >= 0x110000 || (codepoint & 0xFFFFF800) == 0xD800) {
+            throw std::invalid_argument("ill-formed UTF-8 literal");
+        }
+        pos += count;
+
+        return codepoint;
+    }
+
+    static constexpr char32_t decode(char16_t const *str, size_t length, size_t &pos) {
+        char32_t const unit = str[pos++];
+        if((unit & 0xF800) != 0xD800) {
+            return unit;
+        } else if(unit >= 0xDC00 || pos == length || (str[pos] & 0xFC00) != 0xDC00) {
+            throw std::invalid_argument("ill-formed UTF-16 literal");
+        }
+
+        return 0x10000 + ((unit - 0xD800) << 10) + (str[pos++] - 0xDC00);
+    }
+
+    static constexpr char32_t decode(char32_t const *str, size_t, size_t &pos) {
+        char32_t const codepoint = str[pos++];
+        if(codepoint >= 0x110000 || (codepoint & 0xFFFFF800) == 0xD800) {
+            throw std::invalid_argument("ill-formed UTF-32 literal");
+        }
+
+        return codepoint;
+    }
+
+    /**
+     * Encodes the code point to out, unless it is null, and returns the number of units it takes.
+     */
+    static constexpr size_t encode(char32_t codepoint, char *out) {
+        size_t const count = codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2 : codepoint < 0x10000 ? 3 : 4;
+        if(out) {
+            if(count == 1) {
+                out[0] = static_cast<char>(codepoint);
+                return 1;
+            }
+            for(size_t i = count - 1; i > 0; --i) {
+                out[i] = static_cast<char>(0x80 | (codepoint & 0x3F));
+                codepoint >>= 6;
+            }
+            out[0] = static_cast<char>(((0xFF00 >> count) & 0xFF) | codepoint);
+        }
+
+        return count;
+    }
+
+    static constexpr size_t encode(char32_t codepoint, char16_t *out) {
+        if(codepoint < 0x10000) {
+            if(out) {
+                out[0] = static_cast<char16_t>(codepoint);
+            }
+            return 1;
+        }
+        if(out) {
+            out[0] = static_cast<char16_t>(0xD800 + ((codepoint - 0x10000) >> 10));
+            out[1] = static_cast<char16_t>(0xDC00 + (codepoint & 0x3FF));
+        }
+
+        return 2;
+    }
+
+    static constexpr size_t encode(char32_t codepoint, char32_t *out) {
+        if(out) {
+            out[0] = codepoint;
+        }
+
+        return 1;
+    }
+
+    /**
+     * Returns the number of units the conversion of the given literal to ToType takes.
+     */
+    template <typename ToType, typename FromType, size_t Size>
+    static constexpr size_t transcoded_length(unistring_literal_units<FromType, Size> const &source, size_t length) {
+        size_t written = 0;
+        for(size_t pos = 0; pos < length;) {
+            written += unistring_literal_codec::encode(unistring_literal_codec::decode(source.units, length, pos),
+                                                       static_cast<ToType *>(nullptr));
+        }
+
+        return written;
+    }
+
+    /**
+     * Returns the conversion of the given literal to ToType, null-terminated, in Size units.
+     */
+    template <typename ToType, size_t Size, typename FromType, size_t SourceSize>
+    static constexpr unistring_literal_units<ToType, Size>
+        transcode(unistring_literal_units<FromType, SourceSize> const &source, size_t length) {
+        unistring_literal_units<ToType, Size> result{};
+        size_t written = 0;
+        for(size_t pos = 0; pos < length;) {
+            written += unistring_literal_codec::encode(unistring_literal_codec::decode(source.units, length, pos),
+                                                       result.units + written);
+        }
+
+        return result;
+    }
+};
+
+/**
+ * Static storage of the given literal converted to ToType, the units being a template argument list so that the
+ * length of the conversion is a constant too.
+ */
+template <typename ToType, typename FromType, FromType... Units>
+struct unistring_literal_storage {
+    using source_type = unistring_literal_units<FromType, sizeof...(Units) + 1>;
+
+    static constexpr size_t length =
+        unistring_literal_codec::transcoded_length<ToType>(source_type{{Units..., 0}}, sizeof...(Units));
+    static constexpr unistring_literal_units<ToType, length + 1> storage =
+        unistring_literal_codec::transcode<ToType, length + 1>(source_type{{Units..., 0}}, sizeof...(Units));
+};
+
+template <typename ToType, typename FromType, FromType... Units>
+constexpr size_t unistring_literal_storage<ToType, FromType, Units...>::length;
+template <typename ToType, typename FromType, FromType... Units>
+constexpr unistring_literal_units<ToType, unistring_literal_storage<ToType, FromType, Units...>::length + 1>
+    unistring_literal_storage<ToType, FromType, Units...>::storage;
+
+// String literal operator templates, which receive the units of the literal as template arguments, are a GNU extension
+// that GCC and Clang support. Elsewhere, the literals in the encoding of the operator are referred to in place, and
+// the others are converted at run time, once per literal, into storage kept until the program exits. Defining
+// UNISTRING_CONSTEXPR_LITERALS to 0 selects the latter everywhere.
+#if defined(__GNUC__) && !defined(UNISTRING_CONSTEXPR_LITERALS)
+#define UNISTRING_CONSTEXPR_LITERALS 1
+#endif
+
 namespace unistring_literals {
-    basic_unistring<char> operator""_u8(char const *str, size_t length);
-    basic_unistring<char16_t> operator""_u16(char const *str, size_t length);
-    basic_unistring<char32_t> operator""_u32(char const *str, size_t length);
+#if UNISTRING_CONSTEXPR_LITERALS
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#ifdef __clang__
+#pragma clang diagnostic ignored "-Wgnu-string-literal-operator-template"
+#endif
+    /**
+     * Converts the literal, in any encoding, to UTF-8, UTF-16 or UTF-32 at compile time, and returns a view of the
+     * static storage holding the conversion.
+     */
+    template <typename FromType, FromType... Units>
+    constexpr unistring_literal<char> operator""_u8v() {
+        using literal = unistring_literal_storage<char, FromType, Units...>;
+        return {literal::storage.units, literal::length};
+    }
+
+    template <typename FromType, FromType... Units>
+    constexpr unistring_literal<char16_t> operator""_u16v() {
+        using literal = unistring_literal_storage<char16_t, FromType, Units...>;
+        return {literal::storage.units, literal::length};
+    }
+
+    template <typename FromType, FromType... Units>
+    constexpr unistring_literal<char32_t> operator""_u32v() {
+        using literal = unistring_literal_storage<char32_t, FromType, Units...>;
+        return {literal::storage.units, literal::length};
+    }
+
+    /**
+     * Returns a basic_unistring holding the literal, in any encoding, converted to UTF-8, UTF-16 or UTF-32 at compile
+     * time, so that only the copy is left to run time.
+     */
+    template <typename FromType, FromType... Units>
+    basic_unistring<char> operator""_u8() {
+        return operator""_u8v<FromType, Units...>();
+    }
+
+    template <typename FromType, FromType... Units>
+    basic_unistring<char16_t> operator""_u16() {
+        return operator""_u16v<FromType, Units...>();
+    }
+
+    template <typename FromType, FromType... Units>
+    basic_unistring<char32_t> operator""_u32() {
+        return operator""_u32v<FromType, Units...>();
+    }
+#pragma GCC diagnostic pop
+#else
+    constexpr unistring_literal<char> operator""_u8v(char const *str, size_t length) {
+        return {str, length};
+    }
+    constexpr unistring_literal<char16_t> operator""_u16v(char16_t const *str, size_t length) {
+        return {str, length};
+    }
+    constexpr unistring_literal<char32_t> operator""_u32v(char32_t const *str, size_t length) {
+        return {str, length};
+    }
+
+    /**
+     * Converts the literal at its first use. An ill-formed literal throws std::invalid_argument.
+     */
+    unistring_literal<char> operator""_u8v(char16_t const *str, size_t length);
+    unistring_literal<char> operator""_u8v(char32_t const *str, size_t length);
+    unistring_literal<char16_t> operator""_u16v(char const *str, size_t length);
+    unistring_literal<char16_t> operator""_u16v(char32_t const *str, size_t length);
+    unistring_literal<char32_t> operator""_u32v(char const *str, size_t length);
+    unistring_literal<char32_t> operator""_u32v(char16_t const *str, size_t length);
+
+    /**
+     * Returns a basic_unistring holding the literal, in any encoding, converted to UTF-8, UTF-16 or UTF-32.
+     */
+    inline basic_unistring<char> operator""_u8(char const *str, size_t length) {
+        return operator""_u8v(str, length);
+    }
+    inline basic_unistring<char> operator""_u8(char16_t const *str, size_t length) {
+        return operator""_u8v(str, length);
+    }
+    inline basic_unistring<char> operator""_u8(char32_t const *str, size_t length) {
+        return operator""_u8v(str, length);
+    }
+    inline basic_unistring<char16_t> operator""_u16(char const *str, size_t length) {
+        return operator""_u16v(str, length);
+    }
+    inline basic_unistring<char16_t> operator""_u16(char16_t const *str, size_t length) {
+        return operator""_u16v(str, length);
+    }
+    inline basic_unistring<char16_t> operator""_u16(char32_t const *str, size_t length) {
+        return operator""_u16v(str, length);
+    }
+    inline basic_unistring<char32_t> operator""_u32(char const *str, size_t length) {
+        return operator""_u32v(str, length);
+    }
+    inline basic_unistring<char32_t> operator""_u32(char16_t const *str, size_t length) {
+        return operator""_u32v(str, length);
+    }
+    inline basic_unistring<char32_t> operator""_u32(char32_t const *str, size_t length) {
+        return operator""_u32v(str, length);
+    }
+#endif
 }
 
+// The conversions between encodings are defined in basic_unistring.cpp. They must be declared before any use, otherwise
+// the generic definitions above would be instantiated in their place.
+template <>
+template <>
+std::string basic_unistring<char16_t>::to_utf8<false>() const;
+template <>
+template <>
+std::string basic_unistring<char32_t>::to_utf8<false>() const;
+template <>
+template <>
+std::u16string basic_unistring<char>::to_utf16<false>() const;
+template <>
+template <>
+std::u16string basic_unistring<char32_t>::to_utf16<false>() const;
+template <>
+template <>
+std::u32string basic_unistring<char>::to_utf32<false>() const;
+template <>
+template <>
+std::u32string basic_unistring<char16_t>::to_utf32<false>() const;
+
+/**
+ * Compares two strings code point by code point, whatever their encodings. Returns a negative value, zero or a
+ * positive value if lhs is respectively before, equal to or after rhs. The strings compare as their conversions to
+ * UTF-32 do, without being converted: a UTF-8 or UTF-16 string ends at its first ill-formed sequence, and a UTF-32
+ * string is taken unit by unit.
+ */
+template <typename CharType, typename CharType2>
+int unistring_compare(basic_unistring<CharType> const &lhs, basic_unistring<CharType2> const &rhs);
+
+/**
+ * Returns whether two strings hold the same code points, whatever their encodings, as unistring_compare tells.
+ */
+template <typename CharType, typename CharType2>
+bool unistring_equal(basic_unistring<CharType> const &lhs, basic_unistring<CharType2> const &rhs);
+
+/**
+ * Hashes the code points of the string as unistring_compare reads them, without converting it, so that equal strings
+ * have the same hash whatever their encodings.
+ */
+template <typename CharType>
+std::size_t unistring_hash(basic_unistring<CharType> const &str);
+
 extern template class basic_unistring<char>;
 extern template class basic_unistring<char16_t>;
 extern template class basic_unistring<char32_t>;
 
+extern template class unistring_stream_transcoder<char, char16_t>;
+extern template class unistring_stream_transcoder<char, char32_t>;
+extern template class unistring_stream_transcoder<char16_t, char>;
+extern template class unistring_stream_transcoder<char16_t, char32_t>;
+extern template class unistring_stream_transcoder<char32_t, char>;
+extern template class unistring_stream_transcoder<char32_t, char16_t>;
+
 template <typename CharType>
 std::ostream &operator<<(std::ostream &stream, basic_unistring<CharType> const &str) {
     stream << str.to_utf8();
@@ -420,107 +1731,203 @@ basic_unistring<CharType, T> operator+(CharType rhs, basic_unistring<CharType, T
 
 // Comparison operators
 
-inline bool operator==(basic_unistring<char32_t> const &lhs, basic_unistring<char32_t> const &rhs) {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+template <typename CharType, typename CharType2>
+inline bool operator==(basic_unistring<CharType> const &lhs, basic_unistring<CharType2> const &rhs) {
+    return unistring_equal(lhs, rhs);
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator==(basic_unistring<CharType> const &lhs, T const &rhs) {
-    return basic_unistring<char32_t>{lhs} == basic_unistring<char32_t>{rhs};
+inline bool operator==(basic_unistring<CharType> const &lhs, T const &rhs) {
+    return lhs == basic_unistring<CharType>{rhs};
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator==(T const &lhs, basic_unistring<CharType> const &rhs) {
+inline bool operator==(T const &lhs, basic_unistring<CharType> const &rhs) {
     return rhs == lhs;
 }
 
-inline bool operator<(basic_unistring<char32_t> const &lhs, basic_unistring<char32_t> const &rhs) {
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+template <typename CharType, typename CharType2>
+inline bool operator!=(basic_unistring<CharType> const &lhs, basic_unistring<CharType2> const &rhs) {
+    return !(lhs == rhs);
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator<(basic_unistring<CharType> const &lhs, T const &rhs) {
-    return basic_unistring<char32_t>{lhs} < basic_unistring<char32_t>{rhs};
+inline bool operator!=(basic_unistring<CharType> const &lhs, T const &rhs) {
+    return !(lhs == rhs);
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator<(T const &lhs, basic_unistring<CharType> const &rhs) {
-    return rhs > lhs;
+inline bool operator!=(T const &lhs, basic_unistring<CharType> const &rhs) {
+    return !(rhs == lhs);
 }
 
-inline bool operator!=(basic_unistring<char32_t> const &lhs, basic_unistring<char32_t> const &rhs) {
-    return !(lhs == rhs);
+template <typename CharType, typename CharType2>
+inline bool operator<(basic_unistring<CharType> const &lhs, basic_unistring<CharType2> const &rhs) {
+    return unistring_compare(lhs, rhs) < 0;
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator!=(basic_unistring<CharType> const &lhs, T const &rhs) {
-    return basic_unistring<char32_t>{lhs} != basic_unistring<char32_t>{rhs};
+inline bool operator<(basic_unistring<CharType> const &lhs, T const &rhs) {
+    return lhs < basic_unistring<CharType>{rhs};
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator!=(T const &lhs, basic_unistring<CharType> const &rhs) {
-    return rhs != lhs;
+inline bool operator<(T const &lhs, basic_unistring<CharType> const &rhs) {
+    return rhs > lhs;
 }
 
-inline bool operator>(basic_unistring<char32_t> const &lhs, basic_unistring<char32_t> const &rhs) {
-    return rhs < lhs;
+template <typename CharType, typename CharType2>
+inline bool operator>(basic_unistring<CharType> const &lhs, basic_unistring<CharType2> const &rhs) {
+    return unistring_compare(lhs, rhs) > 0;
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator>(basic_unistring<CharType> const &lhs, T const &rhs) {
-    return basic_unistring<char32_t>{lhs} > basic_unistring<char32_t>{rhs};
+inline bool operator>(basic_unistring<CharType> const &lhs, T const &rhs) {
+    return lhs > basic_unistring<CharType>{rhs};
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator>(T const &lhs, basic_unistring<CharType> const &rhs) {
+inline bool operator>(T const &lhs, basic_unistring<CharType> const &rhs) {
     return rhs < lhs;
 }
 
-inline bool operator>=(basic_unistring<char32_t> const &lhs, basic_unistring<char32_t> const &rhs) {
-    return !(lhs < rhs);
+template <typename CharType, typename CharType2>
+inline bool operator<=(basic_unistring<CharType> const &lhs, basic_unistring<CharType2> const &rhs) {
+    return unistring_compare(lhs, rhs) <= 0;
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator>=(basic_unistring<CharType> const &lhs, T const &rhs) {
-    return basic_unistring<char32_t>{lhs} >= basic_unistring<char32_t>{rhs};
+inline bool operator<=(basic_unistring<CharType> const &lhs, T const &rhs) {
+    return lhs <= basic_unistring<CharType>{rhs};
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator>=(T const &lhs, basic_unistring<CharType> const &rhs) {
-    return !(rhs < lhs);
+inline bool operator<=(T const &lhs, basic_unistring<CharType> const &rhs) {
+    return rhs >= lhs;
+}
+
+template <typename CharType, typename CharType2>
+inline bool operator>=(basic_unistring<CharType> const &lhs, basic_unistring<CharType2> const &rhs) {
+    return unistring_compare(lhs, rhs) >= 0;
 }
 
-inline bool operator<=(basic_unistring<char32_t> const &lhs, basic_unistring<char32_t> const &rhs) {
-    return !(lhs > rhs);
+template <typename CharType, typename T>
+inline bool operator>=(basic_unistring<CharType> const &lhs, T const &rhs) {
+    return lhs >= basic_unistring<CharType>{rhs};
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator<=(basic_unistring<CharType> const &lhs, T const &rhs) {
-    return basic_unistring<char32_t>{lhs} <= basic_unistring<char32_t>{rhs};
+inline bool operator>=(T const &lhs, basic_unistring<CharType> const &rhs) {
+    return rhs <= lhs;
+}
+
+// unistring_literal operands, which deduction does not convert to basic_unistring on its own. The operators between a
+// basic_unistring and a literal are those above, through the converting constructor.
+
+template <typename T>
+struct unistring_is_string : std::false_type {};
+template <typename CharType>
+struct unistring_is_string<basic_unistring<CharType>> : std::true_type {};
+
+template <typename T>
+struct unistring_is_literal : std::false_type {};
+template <typename CharType>
+struct unistring_is_literal<unistring_literal<CharType>> : std::true_type {};
+
+template <typename T>
+using unistring_literal_lhs_t = std::enable_if_t<!unistring_is_string<T>::value>;
+template <typename T>
+using unistring_literal_rhs_t = std::enable_if_t<!unistring_is_string<T>::value && !unistring_is_literal<T>::value>;
+
+template <typename CharType>
+std::ostream &operator<<(std::ostream &stream, unistring_literal<CharType> const &str) {
+    return stream << basic_unistring<CharType>(str);
+}
+
+template <typename CharType, typename CharType2>
+basic_unistring<CharType> operator+(unistring_literal<CharType> const &lhs, unistring_literal<CharType2> const &rhs) {
+    return basic_unistring<CharType>(lhs).append(basic_unistring<CharType2>(rhs));
 }
 
 template <typename CharType, typename T>
-inline std::enable_if_t<!std::is_same_v<T, basic_unistring<char32_t>>, bool>
-    operator<=(T const &lhs, basic_unistring<CharType> const &rhs) {
-    return !(rhs > lhs);
+basic_unistring<CharType> operator+(unistring_literal<CharType> const &lhs, T const &rhs) {
+    return basic_unistring<CharType>(lhs) + rhs;
+}
+
+template <typename CharType, typename T, typename CharType2>
+basic_unistring<CharType, T> operator+(basic_unistring<CharType, T> const &lhs, unistring_literal<CharType2> const &rhs) {
+    return basic_unistring<CharType, T>(lhs).append(rhs);
+}
+
+template <typename T, typename CharType>
+decltype(auto) operator+(T const &lhs, unistring_literal<CharType> const &rhs) {
+    return lhs + basic_unistring<CharType>(rhs);
+}
+
+template <typename CharType, typename T, typename = unistring_literal_lhs_t<T>>
+inline bool operator==(unistring_literal<CharType> const &lhs, T const &rhs) {
+    return basic_unistring<CharType>(lhs) == rhs;
+}
+
+template <typename T, typename CharType, typename = unistring_literal_rhs_t<T>>
+inline bool operator==(T const &lhs, unistring_literal<CharType> const &rhs) {
+    return lhs == basic_unistring<CharType>(rhs);
+}
+
+template <typename CharType, typename T, typename = unistring_literal_lhs_t<T>>
+inline bool operator!=(unistring_literal<CharType> const &lhs, T const &rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename T, typename CharType, typename = unistring_literal_rhs_t<T>>
+inline bool operator!=(T const &lhs, unistring_literal<CharType> const &rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename CharType, typename T, typename = unistring_literal_lhs_t<T>>
+inline bool operator<(unistring_literal<CharType> const &lhs, T const &rhs) {
+    return basic_unistring<CharType>(lhs) < rhs;
+}
+
+template <typename T, typename CharType, typename = unistring_literal_rhs_t<T>>
+inline bool operator<(T const &lhs, unistring_literal<CharType> const &rhs) {
+    return lhs < basic_unistring<CharType>(rhs);
+}
+
+template <typename CharType, typename T, typename = unistring_literal_lhs_t<T>>
+inline bool operator>(unistring_literal<CharType> const &lhs, T const &rhs) {
+    return basic_unistring<CharType>(lhs) > rhs;
+}
+
+template <typename T, typename CharType, typename = unistring_literal_rhs_t<T>>
+inline bool operator>(T const &lhs, unistring_literal<CharType> const &rhs) {
+    return lhs > basic_unistring<CharType>(rhs);
+}
+
+template <typename CharType, typename T, typename = unistring_literal_lhs_t<T>>
+inline bool operator<=(unistring_literal<CharType> const &lhs, T const &rhs) {
+    return basic_unistring<CharType>(lhs) <= rhs;
+}
+
+template <typename T, typename CharType, typename = unistring_literal_rhs_t<T>>
+inline bool operator<=(T const &lhs, unistring_literal<CharType> const &rhs) {
+    return lhs <= basic_unistring<CharType>(rhs);
+}
+
+template <typename CharType, typename T, typename = unistring_literal_lhs_t<T>>
+inline bool operator>=(unistring_literal<CharType> const &lhs, T const &rhs) {
+    return basic_unistring<CharType>(lhs) >= rhs;
+}
+
+template <typename T, typename CharType, typename = unistring_literal_rhs_t<T>>
+inline bool operator>=(T const &lhs, unistring_literal<CharType> const &rhs) {
+    return lhs >= basic_unistring<CharType>(rhs);
 }
 
 template <typename CharType>
 struct std::hash<basic_unistring<CharType>> {
-    // Horribly inefficient, this has to be rewritten.
     size_t operator()(basic_unistring<CharType> const &key) const {
-        return std::hash<std::basic_string<char32_t>>{}(key.to_utf32());
+        return unistring_hash(key);
     }
 };
 
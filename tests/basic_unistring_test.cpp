@@ -0,0 +1,863 @@
+//
+//  basic_unistring_test.cpp
+//
+//  Regression checks of basic_unistring. Returns a non-zero status if any fails.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "basic_unistring.h"
+
+namespace {
+    int failures = 0;
+
+    void check(bool condition, char const *what) {
+        if(!condition) {
+            std::fprintf(stderr, "FAILED: %s\n", what);
+            ++failures;
+        }
+    }
+
+#define CHECK(condition) check((condition), #condition)
+
+    /*
+     * Comparisons across encodings must not depend on the order of the operands, ill-formed units included.
+     */
+    template <typename CharType, typename CharType2>
+    void check_symmetric(basic_unistring<CharType> const &lhs, basic_unistring<CharType2> const &rhs) {
+        bool const equal = lhs == rhs;
+        CHECK(equal == (rhs == lhs));
+        CHECK((lhs < rhs) == (rhs > lhs));
+        CHECK((lhs > rhs) == (rhs < lhs));
+        CHECK(equal == (!(lhs < rhs) && !(rhs < lhs)));
+    }
+
+    void test_cross_encoding_comparison() {
+        basic_unistring<char> const ill_formed(std::string("\xC3\xA9\xFF"));
+        basic_unistring<char16_t> const e_acute(std::u16string(u"\u00E9"));
+        basic_unistring<char16_t> const replacement(std::u16string(u"\u00E9\uFFFD"));
+        basic_unistring<char32_t> const lone_surrogate(std::u32string(1, char32_t(0xD800)));
+        basic_unistring<char16_t> const lone_surrogate16(std::u16string(1, char16_t(0xD800)));
+
+        CHECK(ill_formed == e_acute);
+        CHECK(e_acute == ill_formed);
+        CHECK(ill_formed < replacement);
+        CHECK(!(lone_surrogate == lone_surrogate16));
+        CHECK(lone_surrogate16 < lone_surrogate);
+        CHECK(basic_unistring<char>(std::string("\xFF" "a")) == basic_unistring<char>(std::string("\xFE" "b")));
+        CHECK(basic_unistring<char>(std::string("a\xC3")) < basic_unistring<char>(std::string("a\xC3\xA9")));
+
+        check_symmetric(ill_formed, e_acute);
+        check_symmetric(ill_formed, replacement);
+        check_symmetric(ill_formed, lone_surrogate);
+        check_symmetric(lone_surrogate, lone_surrogate16);
+        check_symmetric(basic_unistring<char>(std::string("\xF0\x9F\x98\x80")), e_acute);
+        check_symmetric(basic_unistring<char>(std::string("\xC3\xA9")), e_acute);
+    }
+
+    /*
+     * Text in the three encodings, U+D800 standing for an ill-formed unit: a 0xFF byte, a lone surrogate in UTF-16 and
+     * UTF-32.
+     */
+    struct random_text {
+        std::string utf8;
+        std::u16string utf16;
+        std::u32string utf32;
+
+        void append(char32_t codepoint) {
+            if(codepoint == 0xD800) {
+                utf8 += '\xFF';
+            } else if(codepoint < 0x80) {
+                utf8 += static_cast<char>(codepoint);
+            } else {
+                int const continuations = codepoint < 0x800 ? 1 : codepoint < 0x10000 ? 2 : 3;
+                utf8 += static_cast<char>(((0xFF00 >> (continuations + 1)) & 0xFF) | (codepoint >> (6 * continuations)));
+                for(int shift = 6 * (continuations - 1); shift >= 0; shift -= 6) {
+                    utf8 += static_cast<char>(0x80 | ((codepoint >> shift) & 0x3F));
+                }
+            }
+            if(codepoint >= 0x10000) {
+                utf16 += char16_t(0xD800 + ((codepoint - 0x10000) >> 10));
+                utf16 += char16_t(0xDC00 + (codepoint & 0x3FF));
+            } else {
+                utf16 += char16_t(codepoint);
+            }
+            utf32 += codepoint;
+        }
+    };
+
+    template <typename CharType>
+    basic_unistring<CharType> encoded(random_text const &text);
+
+    template <>
+    basic_unistring<char> encoded(random_text const &text) {
+        return basic_unistring<char>(text.utf8);
+    }
+
+    template <>
+    basic_unistring<char16_t> encoded(random_text const &text) {
+        return basic_unistring<char16_t>(text.utf16);
+    }
+
+    template <>
+    basic_unistring<char32_t> encoded(random_text const &text) {
+        return basic_unistring<char32_t>(text.utf32);
+    }
+
+    int sign(int value) {
+        return value < 0 ? -1 : value > 0;
+    }
+
+    /*
+     * Comparisons must give what comparing the conversions to UTF-32 gives, those stopping at the first ill-formed
+     * sequence of UTF-8 and UTF-16 strings, and equal strings must have the same hash.
+     */
+    template <typename CharType, typename CharType2>
+    void check_utf32_order(random_text const &lhs_text, random_text const &rhs_text) {
+        basic_unistring<CharType> const lhs = encoded<CharType>(lhs_text);
+        basic_unistring<CharType2> const rhs = encoded<CharType2>(rhs_text);
+        basic_unistring<char32_t> const lhs_utf32(lhs), rhs_utf32(rhs);
+        std::u32string const lhs_units(lhs_utf32.data(), lhs_utf32.size());
+        int const expected = sign(lhs_units.compare(std::u32string(rhs_utf32.data(), rhs_utf32.size())));
+        CHECK(sign(unistring_compare(lhs, rhs)) == expected);
+        CHECK((lhs == rhs) == (expected == 0));
+        CHECK((lhs < rhs) == (expected < 0));
+        CHECK((lhs >= rhs) == (expected >= 0));
+        if(expected == 0) {
+            CHECK(std::hash<basic_unistring<CharType>>{}(lhs) == std::hash<basic_unistring<CharType2>>{}(rhs));
+        }
+    }
+
+    template <typename CharType>
+    void check_utf32_order_from(random_text const &lhs, random_text const &rhs) {
+        check_utf32_order<CharType, char>(lhs, rhs);
+        check_utf32_order<CharType, char16_t>(lhs, rhs);
+        check_utf32_order<CharType, char32_t>(lhs, rhs);
+    }
+
+    void test_utf32_order() {
+        char32_t const alphabet[] = {U'a', U'b', 0xE9, 0x20AC, 0xE000, 0xFFFD, 0x1F600, 0xD800};
+        std::uint32_t state = 12345;
+        auto next = [&state](unsigned bound) {
+            state = state * 1103515245 + 12345;
+            return (state >> 16) % bound;
+        };
+        for(int i = 0; i < 3000; ++i) {
+            unsigned const letters = i % 4 == 0 ? 2 : 8;
+            std::vector<unsigned> tokens(next(80));
+            for(unsigned &token : tokens) {
+                token = next(letters);
+            }
+            random_text lhs, rhs;
+            for(unsigned token : tokens) {
+                lhs.append(alphabet[token]);
+            }
+            tokens.resize(next(tokens.size() + 1));
+            for(unsigned tail = next(4); tail > 0; --tail) {
+                tokens.push_back(next(letters));
+            }
+            for(unsigned token : tokens) {
+                rhs.append(alphabet[token]);
+            }
+            if(i % 8 == 0) {
+                rhs = lhs;
+            }
+            check_utf32_order_from<char>(lhs, rhs);
+            check_utf32_order_from<char16_t>(lhs, rhs);
+            check_utf32_order_from<char32_t>(lhs, rhs);
+        }
+    }
+
+    /*
+     * The _u8, _u16 and _u32 literals are basic_unistring objects, and the _u8v, _u16v and _u32v views stream,
+     * concatenate, compare and convert like them.
+     */
+    void test_literals() {
+        using namespace unistring_literals;
+
+        auto text = "e\u0301"_u8;
+        text.normalize();
+        text += "x"_u8;
+        CHECK(text.to_utf16() == u"\u00E9x");
+        basic_unistring<char16_t> const wide = U"\U0001F600"_u16;
+        CHECK(wide.size() == 2 && wide == "\U0001F600"_u32);
+
+        std::ostringstream stream;
+        stream << "x"_u8v << u"é"_u8v << U"é"_u16v;
+        CHECK(stream.str() == "x\xC3\xA9\xC3\xA9");
+
+        basic_unistring<char32_t> const converted = "xé"_u8v;
+        CHECK(converted == U"xé"_u32v);
+        CHECK("a"_u8v + "b"_u8v == "ab"_u8v);
+        CHECK("a"_u8v + u"é"_u16v == U"aé"_u32v);
+        CHECK(basic_unistring<char16_t>(std::u16string(u"a")) + "é"_u8v == "aé"_u8v);
+        CHECK("x"_u8v == basic_unistring<char16_t>(std::u16string(u"x")));
+        CHECK(basic_unistring<char16_t>(std::u16string(u"x")) == "x"_u8v);
+        CHECK("a"_u8v < "é"_u16v);
+        CHECK("a"_u8v == "a");
+        CHECK("a"_u8v != std::string("b"));
+        CHECK("é"_u8v == "é"_u8);
+    }
+
+    /*
+     * Conversion through an output iterator, which goes 256 units at a time, must match the whole conversion, with
+     * sequences straddling the chunks and strings of several MiB.
+     */
+    template <typename CharType>
+    void check_output_iterator_transcoding(basic_unistring<CharType> const &str) {
+        std::string utf8;
+        str.to_utf8(std::back_inserter(utf8));
+        CHECK(utf8 == str.to_utf8());
+        std::u16string utf16;
+        str.to_utf16(std::back_inserter(utf16));
+        CHECK(utf16 == str.to_utf16());
+        std::u32string utf32;
+        str.to_utf32(std::back_inserter(utf32));
+        CHECK(utf32 == str.to_utf32());
+    }
+
+    void test_output_iterator_transcoding() {
+        std::string const ascii_tail = std::string(std::size_t(4) << 20, 'a') + "\xC3\xA9";
+        std::string mixed;
+        for(std::size_t i = 0; mixed.size() < (std::size_t(3) << 20); ++i) {
+            mixed += i % 7 == 0 ? "\xF0\x9F\x98\x80" : i % 5 == 0 ? "\xE2\x82\xAC" : i % 3 == 0 ? "\xC3\xA9" : "a";
+        }
+        for(std::string const &text : {ascii_tail, mixed, std::string(1000, 'b') + "\xF0\x9F\x98\x80\xFF" + mixed.substr(0, 999)}) {
+            basic_unistring<char> const utf8(text);
+            check_output_iterator_transcoding(utf8);
+            check_output_iterator_transcoding(basic_unistring<char16_t>(utf8));
+            check_output_iterator_transcoding(basic_unistring<char32_t>(utf8));
+        }
+    }
+
+    /*
+     * Copies build their own offset index, and writes through a pointer taken before a query are seen once a
+     * non-const member is called again, as documented by basic_unistring::begin.
+     */
+    void test_derived_state() {
+        std::string text;
+        for(int i = 0; i < 1000; ++i) {
+            text += "a\xC3\xA9\xF0\x9F\x98\x80";
+        }
+        basic_unistring<char> shared(text);
+        std::size_t const count = shared.codepoint_count();
+        CHECK(count == 3000);
+
+        std::vector<std::thread> readers;
+        bool offsets_agree[4] = {};
+        for(bool &agree : offsets_agree) {
+            readers.emplace_back([&shared, &agree] {
+                agree = shared.codepoint_offset(1501) == 500 * 7 + 1 && shared.codepoint_index(7 * 999) == 2997;
+            });
+        }
+        std::vector<basic_unistring<char>> copies;
+        for(int i = 0; i < 16; ++i) {
+            copies.push_back(shared);
+        }
+        for(auto &reader : readers) {
+            reader.join();
+        }
+        for(bool agree : offsets_agree) {
+            CHECK(agree);
+        }
+
+        copies[0].append("\xC3\xA9");
+        CHECK(copies[0].codepoint_count() == count + 1);
+        CHECK(copies[0].codepoint_offset(count) == text.size());
+        CHECK(copies[1].codepoint_count() == count);
+        CHECK(shared.codepoint_count() == count);
+        CHECK(shared.codepoint_offset(count) == text.size());
+
+        // Reading through const access keeps what is known, and so the answers.
+        std::size_t ascii = 0;
+        for(auto it = shared.cbegin(); it != shared.cend(); ++it) {
+            ascii += static_cast<unsigned char>(*it) < 0x80;
+        }
+        CHECK(ascii == 1000);
+        CHECK(shared.codepoint_offset(1501) == 500 * 7 + 1);
+
+        // A write through an earlier pointer is seen after the next non-const member call.
+        basic_unistring<char> ascii_string(std::string(200, 'e'));
+        char *units = ascii_string.data();
+        CHECK(ascii_string.codepoint_count() == 200);
+        CHECK(ascii_string.is_normalized(unistring_normalization_form::nfd));
+        units[100] = '\xCC';
+        units[101] = '\x81';
+        ascii_string.begin();
+        CHECK(ascii_string.codepoint_count() == 199);
+        CHECK(ascii_string.codepoint_offset(101) == 102);
+        CHECK(ascii_string.is_normalized(unistring_normalization_form::nfd));
+        CHECK(!ascii_string.is_normalized(unistring_normalization_form::nfc));
+    }
+
+    void write_misordered_marks(char *units) {
+        std::memcpy(units, "\xCC\x81\xCC\x96", 4);
+    }
+
+    template <typename CharType>
+    void write_misordered_marks(CharType *units) {
+        units[0] = 0x301;
+        units[1] = 0x316;
+    }
+
+    /*
+     * Returns the forms the string is known to be in, a bit per form. A copy keeps what is known, which writing
+     * through c_str() does not drop: once the copy holds marks out of canonical order, in no form, only the known
+     * forms are still reported. The string must have 4 units at least.
+     */
+    template <typename CharType>
+    unsigned known_forms(basic_unistring<CharType> const &str) {
+        CHECK(str.size() >= 4);
+        basic_unistring<CharType> probe(str);
+        auto units = const_cast<CharType *>(probe.c_str());
+        std::fill(units, units + probe.size(), CharType('a'));
+        write_misordered_marks(units);
+        unsigned forms = 0;
+        for(int form = 0; form <= static_cast<int>(unistring_normalization_form::nfkc_casefold); ++form) {
+            if(probe.is_normalized(static_cast<unistring_normalization_form>(form))) {
+                forms |= 1u << form;
+            }
+        }
+
+        return forms;
+    }
+
+    template <typename Access>
+    unsigned forms_after(basic_unistring<char> str, Access access) {
+        access(str);
+        return known_forms(str);
+    }
+
+    /*
+     * What is known of a string, its normalization forms and whether it is ASCII, is set by the validating
+     * constructors and the normalizations, kept by copies, conversions and appends that preserve it, and dropped by
+     * every non-const access.
+     */
+    void test_flags() {
+        using form = unistring_normalization_form;
+        auto const bit = [](form normalization) { return 1u << static_cast<int>(normalization); };
+        unsigned const nfc = bit(form::nfc), nfd = bit(form::nfd);
+        unsigned const ascii = nfc | nfd | bit(form::nfkc) | bit(form::nfkd);
+
+        basic_unistring<char> const plain(std::string("abcd"));
+        CHECK(known_forms(plain) == 0);
+        basic_unistring<char> const checked(unistring_checked, std::string("abcd"));
+        CHECK(known_forms(checked) == ascii);
+        CHECK(known_forms(basic_unistring<char>(unistring_checked, std::string("\xC3\xA9" "abc"))) == 0);
+        CHECK(known_forms(basic_unistring<char16_t>(unistring_latin1, std::string("abcd"))) == ascii);
+        CHECK(known_forms(basic_unistring<char32_t>(unistring_windows1252, std::string("\x80" "abc"))) == 0);
+
+        basic_unistring<char> composed(std::string("e\xCC\x81" "abc"));
+        composed.normalize();
+        CHECK(known_forms(composed) == nfc);
+        basic_unistring<char> copy(composed);
+        CHECK(known_forms(copy) == nfc);
+        basic_unistring<char> moved(std::move(copy));
+        CHECK(known_forms(moved) == nfc);
+        basic_unistring<char> swapped(std::string("wxyz"));
+        swapped.swap(moved);
+        CHECK(known_forms(swapped) == nfc);
+        CHECK(known_forms(moved) == 0);
+        CHECK(known_forms(basic_unistring<char16_t>(composed)) == nfc);
+        CHECK(known_forms(basic_unistring<char32_t>(composed)) == nfc);
+        CHECK(known_forms(basic_unistring<char>(composed, 0, 4)) == 0);
+        CHECK(known_forms(basic_unistring<char>(checked, 0)) == ascii);
+
+        CHECK(known_forms(plain.get_normalized(form::nfd)) == nfd);
+        CHECK(known_forms(composed.get_normalized(form::nfd)) == nfd);
+        CHECK(known_forms(composed.get_normalized(form::nfc)) == nfc);
+        basic_unistring<char> upper(std::string("ABCD"));
+        upper.normalize(form::nfkc_casefold);
+        CHECK(upper == basic_unistring<char>(std::string("abcd")));
+        CHECK(known_forms(upper) == bit(form::nfkc_casefold));
+        std::vector<basic_unistring<char>> batch{plain, composed};
+        basic_unistring<char>::normalize(batch.begin(), batch.end(), form::nfd);
+        CHECK(known_forms(batch[0]) == nfd);
+        CHECK(known_forms(batch[1]) == nfd);
+
+        // Appends keep the forms both sides are in when the appended string starts at a boundary, and ASCII.
+        basic_unistring<char> joined(composed);
+        joined += composed;
+        CHECK(known_forms(joined) == nfc);
+        basic_unistring<char> mark(std::string("\xCC\x81"));
+        mark.normalize();
+        joined += mark;
+        CHECK(known_forms(joined) == 0);
+        basic_unistring<char> empty;
+        empty += composed;
+        CHECK(known_forms(empty) == nfc);
+        basic_unistring<char> both(checked);
+        both += checked;
+        CHECK(known_forms(both) == ascii);
+        CHECK(known_forms(basic_unistring<char>(both, 2)) == ascii);
+        both += plain;
+        CHECK(known_forms(both) == 0);
+        basic_unistring<char> appended(plain);
+        appended.append_normalized(basic_unistring<char>(std::string("e\xCC\x81")), form::nfc);
+        CHECK(known_forms(appended) == nfc);
+
+        // Every non-const access drops what is known, even when it only reads; const access does not.
+        using string = basic_unistring<char>;
+        CHECK(forms_after(checked, [](string &str) { str.begin(); }) == 0);
+        CHECK(forms_after(checked, [](string &str) { str.end(); }) == 0);
+        CHECK(forms_after(checked, [](string &str) { str.rbegin(); }) == 0);
+        CHECK(forms_after(checked, [](string &str) { str.rend(); }) == 0);
+        CHECK(forms_after(checked, [](string &str) { str.front(); }) == 0);
+        CHECK(forms_after(checked, [](string &str) { str.back(); }) == 0);
+        CHECK(forms_after(checked, [](string &str) { str.at(1); }) == 0);
+        CHECK(forms_after(checked, [](string &str) { str[1]; }) == 0);
+        CHECK(forms_after(checked, [](string &str) { str.data(); }) == 0);
+        CHECK(forms_after(checked, [](string &str) { str.cbegin(); }) == ascii);
+        CHECK(forms_after(checked, [](string &str) { str.crbegin(); }) == ascii);
+        CHECK(forms_after(checked, [](string &str) { str.c_str(); }) == ascii);
+        CHECK(forms_after(checked, [](string const &str) { str.begin(); }) == ascii);
+        CHECK(forms_after(checked, [](string const &str) { str.at(1); }) == ascii);
+        CHECK(forms_after(checked, [](string const &str) { str[1]; }) == ascii);
+        CHECK(forms_after(checked, [](string const &str) { str.data(); }) == ascii);
+        CHECK(forms_after(composed, [](string &str) { str = std::string("abcd"); }) == 0);
+        CHECK(forms_after(plain, [&checked](string &str) { str = checked; }) == ascii);
+    }
+
+    /*
+     * append_normalized only changes the string once both it and the appended one are found well-formed.
+     */
+    void test_append_normalized() {
+        auto const nfc = unistring_normalization_form::nfc;
+        basic_unistring<char> decomposed(std::string("e\xCC\x81"));
+        basic_unistring<char> const ill_formed(std::string("\xCC\x81\xFF"));
+        bool thrown = false;
+        try {
+            decomposed.append_normalized(ill_formed, nfc);
+        } catch(std::invalid_argument const &) {
+            thrown = true;
+        }
+        CHECK(thrown);
+        CHECK(decomposed == basic_unistring<char>(std::string("e\xCC\x81")));
+        CHECK(!decomposed.is_normalized(nfc));
+
+        basic_unistring<char> composed(std::string("caf\xC3\xA9"));
+        thrown = false;
+        try {
+            composed.append_normalized(ill_formed, nfc);
+        } catch(std::invalid_argument const &) {
+            thrown = true;
+        }
+        CHECK(thrown);
+        CHECK(composed == basic_unistring<char>(std::string("caf\xC3\xA9")));
+
+        basic_unistring<char16_t> head(std::u16string(u"e\u0301"));
+        thrown = false;
+        try {
+            head.append_normalized(basic_unistring<char16_t>(std::u16string(1, char16_t(0xDC00))), nfc);
+        } catch(std::invalid_argument const &) {
+            thrown = true;
+        }
+        CHECK(thrown);
+        CHECK(head == basic_unistring<char16_t>(std::u16string(u"e\u0301")));
+
+        decomposed.append_normalized(basic_unistring<char>(std::string("x")), nfc);
+        CHECK(decomposed == basic_unistring<char>(std::string("\xC3\xA9x")));
+        composed.append_normalized(basic_unistring<char>(std::string("\xCC\x81")), nfc);
+        CHECK(composed == basic_unistring<char>(std::string("caf\xC3\xA9\xCC\x81")));
+        head.append_normalized(basic_unistring<char16_t>(std::u16string(u"\u0327")), nfc);
+        CHECK(head == basic_unistring<char16_t>(std::u16string(u"\u0229\u0301")));
+        CHECK(head.is_normalized(nfc));
+    }
+
+    using decoded_codepoints = std::vector<std::pair<std::size_t, char32_t>>;
+
+    std::string const &units(random_text const &text, char) {
+        return text.utf8;
+    }
+
+    std::u16string const &units(random_text const &text, char16_t) {
+        return text.utf16;
+    }
+
+    std::u32string const &units(random_text const &text, char32_t) {
+        return text.utf32;
+    }
+
+    /*
+     * Feeds the units of source to the transcoder in chunks of up to 5 units, empty ones included, so that sequences
+     * get split at every position. Returns whether every call succeeded.
+     */
+    template <typename FromType, typename ToType, typename Next>
+    bool feed_chunks(unistring_stream_transcoder<FromType, ToType> &transcoder,
+                     std::basic_string<FromType> const &source,
+                     std::basic_string<ToType> &out,
+                     Next &next) {
+        bool succeeded = true;
+        for(std::size_t pos = 0; pos < source.size();) {
+            std::size_t const length = std::min<std::size_t>(next(6), source.size() - pos);
+            succeeded = transcoder.feed(source.data() + pos, length, out) && succeeded;
+            pos += length;
+        }
+
+        return succeeded;
+    }
+
+    /*
+     * A chunked text must convert like the whole text. An ill-formed unit makes the feed reaching it fail, and a text
+     * ending in the middle of a sequence makes finish() fail; in both cases out holds the conversion of what came
+     * before, and the transcoder can then be reused.
+     */
+    template <typename FromType, typename ToType, typename Next>
+    void check_stream_transcoder(unistring_stream_transcoder<FromType, ToType> &transcoder,
+                                 random_text const &good,
+                                 random_text const &ill_formed,
+                                 random_text const &truncated,
+                                 Next &next) {
+        std::basic_string<ToType> const expected = units(good, ToType());
+        std::basic_string<ToType> out;
+        CHECK(feed_chunks(transcoder, units(good, FromType()), out, next));
+        CHECK(transcoder.finish());
+        CHECK(out == expected);
+
+        out.clear();
+        CHECK(!feed_chunks(transcoder, units(ill_formed, FromType()), out, next));
+        CHECK(!transcoder.finish());
+        CHECK(out == expected);
+
+        // UTF-32 has no sequences to split.
+        std::basic_string<FromType> const &complete = units(truncated, FromType());
+        if(complete.size() > units(good, FromType()).size() + 1) {
+            std::size_t const cut = 1 + next(complete.size() - units(good, FromType()).size() - 1);
+            out.clear();
+            CHECK(feed_chunks(transcoder, complete.substr(0, complete.size() - cut), out, next));
+            CHECK(!transcoder.finish());
+            CHECK(out == expected);
+        }
+    }
+
+    template <typename FromType, typename ToType, typename Next>
+    void check_stream_transcoder(random_text const &good,
+                                 random_text const &ill_formed,
+                                 random_text const &truncated,
+                                 Next &next) {
+        unistring_stream_transcoder<FromType, ToType> transcoder;
+        for(int repeat = 0; repeat < 2; ++repeat) {
+            check_stream_transcoder(transcoder, good, ill_formed, truncated, next);
+        }
+    }
+
+    void test_stream_transcoders() {
+        char32_t const alphabet[] = {U'a', 0x7F, 0x80, 0xE9, 0x7FF, 0x800, 0x20AC, 0xFFFF, 0x10000, 0x1F600, 0x10FFFF};
+        char32_t const multibyte[] = {0xE9, 0x20AC, 0x1F600};
+        std::uint32_t state = 4242;
+        auto next = [&state](std::size_t bound) {
+            state = state * 1103515245 + 12345;
+            return static_cast<unsigned>((state >> 16) % bound);
+        };
+        for(int i = 0; i < 1000; ++i) {
+            random_text good;
+            for(unsigned length = next(30); good.utf32.size() < length;) {
+                good.append(alphabet[next(sizeof(alphabet) / sizeof(alphabet[0]))]);
+            }
+            random_text ill_formed = good, truncated = good;
+            ill_formed.append(0xD800);
+            for(unsigned length = 1 + next(5); length > 0; --length) {
+                ill_formed.append(alphabet[next(sizeof(alphabet) / sizeof(alphabet[0]))]);
+            }
+            truncated.append(multibyte[next(3)]);
+
+            check_stream_transcoder<char, char16_t>(good, ill_formed, truncated, next);
+            check_stream_transcoder<char, char32_t>(good, ill_formed, truncated, next);
+            check_stream_transcoder<char16_t, char>(good, ill_formed, truncated, next);
+            check_stream_transcoder<char16_t, char32_t>(good, ill_formed, truncated, next);
+            check_stream_transcoder<char32_t, char>(good, ill_formed, truncated, next);
+            check_stream_transcoder<char32_t, char16_t>(good, ill_formed, truncated, next);
+        }
+    }
+
+    /*
+     * Code points of the Windows-1252 bytes 0x80 to 0x9F, as the Unicode mapping file gives them; its 5 undefined
+     * bytes are taken as the C1 controls of the same value.
+     */
+    char32_t const windows1252_c1[32] = {0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+                                         0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+                                         0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+                                         0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178};
+
+    char32_t legacy_codepoint(unsigned char byte, bool windows1252) {
+        return windows1252 && byte >= 0x80 && byte < 0xA0 ? windows1252_c1[byte - 0x80] : byte;
+    }
+
+    /*
+     * Decoding a legacy buffer must give each byte's code point in every encoding, and encoding back must give the
+     * buffer again.
+     */
+    template <typename CharType>
+    void check_legacy(std::string const &bytes, random_text const &text) {
+        basic_unistring<CharType> const latin1(unistring_latin1, bytes);
+        basic_unistring<CharType> const windows1252(unistring_windows1252, bytes);
+        CHECK(latin1 == encoded<CharType>(text));
+        CHECK(latin1.to_latin1() == bytes);
+        CHECK(std::equal(windows1252.codepoints().begin(), windows1252.codepoints().end(), bytes.begin(), bytes.end(),
+                         [](char32_t codepoint, char byte) {
+                             return codepoint == legacy_codepoint(static_cast<unsigned char>(byte), true);
+                         }));
+        CHECK(windows1252.to_windows1252() == bytes);
+    }
+
+    /*
+     * Code points an encoding lacks become one '?' each, and the conversion stops at the first ill-formed sequence.
+     */
+    template <typename CharType>
+    void check_legacy_replacement() {
+        random_text text;
+        for(char32_t codepoint : {U'a', char32_t(0x80), char32_t(0x20AC), char32_t(0xE9), char32_t(0x100),
+                                  char32_t(0x2122), char32_t(0x1F600), char32_t(0xD800), U'b'}) {
+            text.append(codepoint);
+        }
+        basic_unistring<CharType> const str = encoded<CharType>(text);
+        CHECK(str.to_latin1() == "a\x80?\xE9???");
+        CHECK(str.to_windows1252() == "a?\x80\xE9?\x99?");
+    }
+
+    void test_legacy_encodings() {
+        std::string all_bytes;
+        random_text all_latin1;
+        for(int byte = 0; byte < 256; ++byte) {
+            all_bytes += static_cast<char>(byte);
+            all_latin1.append(static_cast<char32_t>(byte));
+        }
+        check_legacy<char>(all_bytes, all_latin1);
+        check_legacy<char16_t>(all_bytes, all_latin1);
+        check_legacy<char32_t>(all_bytes, all_latin1);
+        check_legacy_replacement<char>();
+        check_legacy_replacement<char16_t>();
+        check_legacy_replacement<char32_t>();
+
+        // Long runs, mostly ASCII, reach the vectorized kernels and their tails.
+        std::uint32_t state = 1252;
+        auto next = [&state](unsigned bound) {
+            state = state * 1103515245 + 12345;
+            return (state >> 16) % bound;
+        };
+        for(int i = 0; i < 500; ++i) {
+            std::string bytes;
+            random_text text;
+            for(unsigned length = next(200); bytes.size() < length;) {
+                unsigned char const byte = next(8) == 0 ? 0x80 + next(0x80) : next(0x80);
+                bytes += static_cast<char>(byte);
+                text.append(byte);
+            }
+            check_legacy<char>(bytes, text);
+            check_legacy<char16_t>(bytes, text);
+            check_legacy<char32_t>(bytes, text);
+        }
+    }
+
+    /*
+     * Offsets and values of the code points of a buffer, as utf8proc_iterate or a plain decoder read them: a unit that
+     * does not start a well-formed sequence reads as U+FFFD and is skipped alone.
+     */
+    decoded_codepoints reference_codepoints(std::string const &str) {
+        // utf8proc_iterate may read the byte after a truncated two-byte sequence, so it is given a terminated copy.
+        std::vector<utf8proc_uint8_t> const units(str.c_str(), str.c_str() + str.size() + 1);
+        decoded_codepoints result;
+        for(std::size_t pos = 0; pos < str.size();) {
+            utf8proc_int32_t codepoint;
+            utf8proc_ssize_t const count =
+                utf8proc_iterate(units.data() + pos, static_cast<utf8proc_ssize_t>(str.size() - pos), &codepoint);
+            bool const valid = count > 0 && codepoint >= 0;
+            result.emplace_back(pos, valid ? static_cast<char32_t>(codepoint) : 0xFFFD);
+            pos += valid ? static_cast<std::size_t>(count) : 1;
+        }
+
+        return result;
+    }
+
+    decoded_codepoints reference_codepoints(std::u16string const &str) {
+        decoded_codepoints result;
+        for(std::size_t pos = 0; pos < str.size();) {
+            char32_t const unit = str[pos];
+            if(unit >= 0xD800 && unit < 0xDC00 && pos + 1 < str.size() && str[pos + 1] >= 0xDC00 && str[pos + 1] < 0xE000) {
+                result.emplace_back(pos, 0x10000 + ((unit - 0xD800) << 10) + (str[pos + 1] - 0xDC00));
+                pos += 2;
+            } else {
+                result.emplace_back(pos, unit >= 0xD800 && unit < 0xE000 ? 0xFFFD : unit);
+                pos += 1;
+            }
+        }
+
+        return result;
+    }
+
+    decoded_codepoints reference_codepoints(std::u32string const &str) {
+        decoded_codepoints result;
+        for(std::size_t pos = 0; pos < str.size(); ++pos) {
+            bool const valid = str[pos] < 0x110000 && (str[pos] < 0xD800 || str[pos] >= 0xE000);
+            result.emplace_back(pos, valid ? str[pos] : 0xFFFD);
+        }
+
+        return result;
+    }
+
+    /*
+     * The code point iterator must decode like the reference going forward, ill-formed units included, and retrace
+     * the same code points going backward, which is only promised for well-formed buffers.
+     */
+    template <typename CharType>
+    void check_codepoints(std::basic_string<CharType> const &units, bool well_formed) {
+        basic_unistring<CharType> const str(units);
+        decoded_codepoints const expected = reference_codepoints(units);
+        auto const codepoints = str.codepoints();
+        decoded_codepoints forward, backward;
+        for(auto it = codepoints.begin(); it != codepoints.end(); it++) {
+            forward.emplace_back(it.base() - str.data(), *it);
+        }
+        CHECK(forward == expected);
+        for(auto it = codepoints.end(); it != codepoints.begin();) {
+            --it;
+            backward.emplace(backward.begin(), it.base() - str.data(), *it);
+        }
+        if(well_formed) {
+            CHECK(backward == expected);
+            std::u32string reversed(codepoints.rbegin(), codepoints.rend());
+            CHECK(std::equal(reversed.rbegin(), reversed.rend(), expected.begin(), expected.end(),
+                             [](char32_t codepoint, std::pair<std::size_t, char32_t> const &reference) {
+                                 return codepoint == reference.second;
+                             }));
+        }
+    }
+
+    /*
+     * Inserts one of the given ill-formed sequences, or a random unit, at a random position.
+     */
+    template <typename CharType, typename Next>
+    void corrupt(std::basic_string<CharType> &units,
+                 std::vector<std::basic_string<CharType>> const &ill_formed,
+                 std::uint32_t unit_range,
+                 Next &next) {
+        std::size_t const pos = next(units.size() + 1);
+        unsigned const choice = next(ill_formed.size() + 1);
+        if(choice < ill_formed.size()) {
+            units.insert(pos, ill_formed[choice]);
+        } else {
+            units.insert(units.begin() + pos, static_cast<CharType>(next(unit_range)));
+        }
+    }
+
+    void test_codepoint_iterators() {
+        char32_t const alphabet[] = {U'a', U'\n', 0x7F, 0x80, 0xE9, 0x7FF, 0x800, 0x20AC, 0xD7FF, 0xE000,
+                                     0xFFFD, 0xFFFF, 0x10000, 0x1F600, 0x10FFFF};
+        std::vector<std::string> const utf8_ill_formed = {
+            "\x80", "\xBF", "\xC0\xAF", "\xC3", "\xE2\x82", "\xED\xA0\x80", "\xF0\x9F\x98", "\xF4\x90\x80\x80", "\xFF"};
+        std::vector<std::u16string> const utf16_ill_formed = {
+            std::u16string(1, char16_t(0xD800)), std::u16string(1, char16_t(0xDFFF)), u"\xDC00\xD800"};
+        std::vector<std::u32string> const utf32_ill_formed = {
+            std::u32string(1, char32_t(0xD800)), std::u32string(1, char32_t(0x110000)), std::u32string(1, char32_t(0xFFFFFFFF))};
+        std::uint32_t state = 777;
+        auto next = [&state](std::size_t bound) {
+            state = state * 1103515245 + 12345;
+            return static_cast<unsigned>((state >> 16) % bound);
+        };
+        for(int i = 0; i < 2000; ++i) {
+            random_text text;
+            for(unsigned length = next(30); text.utf32.size() < length;) {
+                text.append(alphabet[next(sizeof(alphabet) / sizeof(alphabet[0]))]);
+            }
+            check_codepoints(text.utf8, true);
+            check_codepoints(text.utf16, true);
+            check_codepoints(text.utf32, true);
+
+            for(int corruptions = 1 + next(3); corruptions > 0; --corruptions) {
+                corrupt(text.utf8, utf8_ill_formed, 0x100, next);
+                corrupt(text.utf16, utf16_ill_formed, 0x10000, next);
+                corrupt(text.utf32, utf32_ill_formed, 0x110000, next);
+            }
+            check_codepoints(text.utf8, false);
+            check_codepoints(text.utf16, false);
+            check_codepoints(text.utf32, false);
+        }
+    }
+
+    template <typename Range>
+    std::u32string decode(Range const &range) {
+        return std::u32string(range.begin(), range.end());
+    }
+
+    /*
+     * The clusters, walked forward and backward, and the cluster substrings must follow utf8proc_grapheme_break
+     * between each pair of code points, an ill-formed unit reading as U+FFFD.
+     */
+    template <typename CharType>
+    void check_graphemes(basic_unistring<CharType> const &str, std::vector<std::u32string> const &expected) {
+        auto const graphemes = str.graphemes();
+        std::vector<std::u32string> forward, backward;
+        for(auto const &cluster : graphemes) {
+            forward.push_back(decode(cluster));
+        }
+        for(auto it = graphemes.rbegin(); it != graphemes.rend(); ++it) {
+            backward.insert(backward.begin(), decode(*it));
+        }
+        CHECK(forward == expected);
+        CHECK(backward == expected);
+
+        std::size_t const index = expected.size() / 3, count = expected.size() / 2;
+        std::u32string middle;
+        for(std::size_t i = index; i < index + count; ++i) {
+            middle += expected[i];
+        }
+        CHECK(decode(str.substr_graphemes(index, count).codepoints()) == middle);
+        basic_unistring<CharType> truncated(str);
+        truncated.truncate_graphemes(count);
+        std::u32string head;
+        for(std::size_t i = 0; i < count; ++i) {
+            head += expected[i];
+        }
+        CHECK(decode(truncated.codepoints()) == head);
+    }
+
+    void test_graphemes() {
+        // A code point of every boundclass, ASCII, a 4-byte sequence and an ill-formed unit.
+        char32_t const alphabet[] = {U'a', U'b', U'\r', U'\n', 0x1, 0x300, 0x1100, 0x1160, 0x11A8, 0xAC00,
+                                     0xAC01, 0x1F1E6, 0x1F1E7, 0x903, 0x200D, 0xE9, 0x1F600, 0xD800};
+        std::uint32_t state = 54321;
+        auto next = [&state](unsigned bound) {
+            state = state * 1103515245 + 12345;
+            return (state >> 16) % bound;
+        };
+        for(int i = 0; i < 2000; ++i) {
+            random_text text;
+            std::vector<std::u32string> expected;
+            char32_t previous = 0;
+            for(unsigned length = next(40); text.utf32.size() < length;) {
+                char32_t const codepoint = alphabet[next(i % 2 == 0 ? 4 : sizeof(alphabet) / sizeof(alphabet[0]))];
+                char32_t const decoded = codepoint == 0xD800 ? 0xFFFD : codepoint;
+                if(expected.empty() || utf8proc_grapheme_break(previous, decoded)) {
+                    expected.emplace_back();
+                }
+                expected.back() += decoded;
+                previous = decoded;
+                text.append(codepoint);
+            }
+            check_graphemes(encoded<char>(text), expected);
+            check_graphemes(encoded<char16_t>(text), expected);
+            check_graphemes(encoded<char32_t>(text), expected);
+        }
+    }
+}
+
+int main() {
+    test_cross_encoding_comparison();
+    test_utf32_order();
+    test_literals();
+    test_output_iterator_transcoding();
+    test_derived_state();
+    test_flags();
+    test_append_normalized();
+    test_graphemes();
+    test_codepoint_iterators();
+    test_stream_transcoders();
+    test_legacy_encodings();
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,527 @@
+//
+//  unistring_kernels_test.cpp
+//
+//  Differential test of the Unicode kernels: the kernels of every instruction set the CPU supports must give the same
+//  results as the scalar ones. The kernels are picked once per process, so the test runs itself again with
+//  UNISTRING_ISA set to each level and the --dump argument, which prints the result of every kernel on a fixed random
+//  corpus of well-formed and ill-formed buffers, one line each; the dumps must then match the scalar one line by line.
+//  Each dump also checks validation, lengths and conversions against decoders independent of the kernels, utf8proc for
+//  UTF-8 and the definitions of UTF-16 and UTF-32, and reports where they disagree.
+//  Every buffer, input or output, is allocated at its exact size, so that an address sanitizer catches the kernels
+//  reading or writing past it.
+//
+
+#include "unistring_kernels.h"
+#include "utf8proc.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace unistring_kernels;
+
+namespace {
+    /*
+     * Number of buffers of each kind in the corpus, and longest buffer: beyond two AVX2 registers, with every tail.
+     */
+    constexpr int corpus_size = 1500;
+    constexpr std::size_t longest_buffer = 300;
+
+    /*
+     * FNV-1a hash of the units of a buffer, which stands for its contents in the dumps.
+     */
+    template <typename Unit>
+    std::uint64_t digest(std::vector<Unit> const &units, std::size_t length) {
+        std::uint64_t hash = 14695981039346656037ull;
+        for(std::size_t i = 0; i < length; ++i) {
+            hash = (hash ^ static_cast<std::uint64_t>(units[i])) * 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+    /*
+     * Description of a conversion to a buffer of the given capacity, sized by the length kernel. That length is only
+     * exact, and so compared, when the whole input is well-formed; otherwise it must merely leave room for what the
+     * conversion wrote.
+     */
+    template <typename Unit>
+    std::string conversion(std::vector<Unit> const &out, std::size_t length, conversion_result result) {
+        std::ostringstream description;
+        if(result.read == length) {
+            description << out.size();
+        } else {
+            description << (result.written <= out.size() ? "fits" : "overflows");
+        }
+        description << ' ' << result.read << ' ' << result.written << ' ' << digest(out, result.written);
+
+        return description.str();
+    }
+
+    /*
+     * Returns a random code point of the given kind: 0, 1 and 2 for 2-, 3- and 4-byte sequences, ASCII otherwise.
+     */
+    char32_t random_codepoint(std::mt19937 &random, unsigned kind) {
+        switch(kind) {
+            case 0:
+                return 0x80 + random() % 0x780;
+            case 1: {
+                char32_t const codepoint = 0x800 + random() % 0xF800;
+                return (codepoint & 0xF800) == 0xD800 ? 0xFFFD : codepoint;
+            }
+            case 2:
+                return 0x10000 + random() % 0x100000;
+            default:
+                return random() % 0x80;
+        }
+    }
+
+    /*
+     * Well-formed text, either of ASCII only or mixing every sequence length, with runs of distinct code points of a
+     * single length so that whole vector windows of each kind occur.
+     */
+    std::vector<char32_t> random_text(std::mt19937 &random) {
+        std::size_t const length = random() % (longest_buffer / 4 + 1);
+        bool const ascii = random() % 4 == 0;
+        std::vector<char32_t> text;
+        while(text.size() < length) {
+            unsigned const kind = ascii ? 3 : random() % 8;
+            std::size_t const run = random() % 4 == 0 ? random() % 40 : 1;
+            for(std::size_t i = 0; i < run && text.size() < length; ++i) {
+                text.push_back(random_codepoint(random, kind));
+            }
+        }
+
+        return text;
+    }
+
+    std::vector<char> encode_utf8(std::vector<char32_t> const &text) {
+        std::vector<char> out;
+        for(char32_t codepoint : text) {
+            if(codepoint < 0x80) {
+                out.push_back(static_cast<char>(codepoint));
+            } else if(codepoint < 0x800) {
+                out.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+                out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            } else if(codepoint < 0x10000) {
+                out.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+                out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            } else {
+                out.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+                out.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+                out.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+            }
+        }
+
+        return out;
+    }
+
+    std::vector<char16_t> encode_utf16(std::vector<char32_t> const &text) {
+        std::vector<char16_t> out;
+        for(char32_t codepoint : text) {
+            if(codepoint < 0x10000) {
+                out.push_back(static_cast<char16_t>(codepoint));
+            } else {
+                out.push_back(static_cast<char16_t>(0xD800 + ((codepoint - 0x10000) >> 10)));
+                out.push_back(static_cast<char16_t>(0xDC00 + (codepoint & 0x3FF)));
+            }
+        }
+
+        return out;
+    }
+
+    std::vector<char32_t> encode_utf32(std::vector<char32_t> const &text) {
+        return text;
+    }
+
+    template <typename Unit>
+    std::vector<Unit> encode(std::vector<char32_t> const &text);
+
+    template <>
+    std::vector<char> encode(std::vector<char32_t> const &text) {
+        return encode_utf8(text);
+    }
+
+    template <>
+    std::vector<char16_t> encode(std::vector<char32_t> const &text) {
+        return encode_utf16(text);
+    }
+
+    template <>
+    std::vector<char32_t> encode(std::vector<char32_t> const &text) {
+        return encode_utf32(text);
+    }
+
+    /*
+     * Code points of the longest well-formed prefix of a buffer, and length of that prefix, as told by a decoder
+     * independent of the kernels.
+     */
+    struct decoded {
+        std::vector<char32_t> codepoints;
+        std::size_t read = 0;
+    };
+
+    decoded reference_decode(std::vector<char> const &str) {
+        // utf8proc_iterate may read the byte after a truncated two-byte sequence, so it is given a terminated copy
+        std::vector<utf8proc_uint8_t> units(str.begin(), str.end());
+        units.push_back(0);
+        decoded result;
+        while(result.read < str.size()) {
+            utf8proc_int32_t codepoint;
+            utf8proc_ssize_t const count = utf8proc_iterate(
+                units.data() + result.read, static_cast<utf8proc_ssize_t>(str.size() - result.read), &codepoint);
+            if(count <= 0 || codepoint < 0) {
+                break;
+            }
+            result.codepoints.push_back(static_cast<char32_t>(codepoint));
+            result.read += static_cast<std::size_t>(count);
+        }
+
+        return result;
+    }
+
+    decoded reference_decode(std::vector<char16_t> const &str) {
+        decoded result;
+        while(result.read < str.size()) {
+            char32_t const unit = str[result.read];
+            if(unit < 0xD800 || unit >= 0xE000) {
+                result.codepoints.push_back(unit);
+                result.read += 1;
+            } else if(unit < 0xDC00 && result.read + 1 < str.size() && str[result.read + 1] >= 0xDC00 &&
+                      str[result.read + 1] < 0xE000) {
+                result.codepoints.push_back(0x10000 + ((unit - 0xD800) << 10) + (str[result.read + 1] - 0xDC00));
+                result.read += 2;
+            } else {
+                break;
+            }
+        }
+
+        return result;
+    }
+
+    decoded reference_decode(std::vector<char32_t> const &str) {
+        decoded result;
+        while(result.read < str.size() && str[result.read] < 0x110000 &&
+              (str[result.read] < 0xD800 || str[result.read] >= 0xE000)) {
+            result.codepoints.push_back(str[result.read++]);
+        }
+
+        return result;
+    }
+
+    /*
+     * Checks a conversion against the reference: it must read up to the first ill-formed sequence and write the
+     * encoding of what it read, and the length kernel that sized out must be exact if the input is well-formed.
+     */
+    template <typename Unit>
+    void check_reference(std::ostream &out, char const *kernel, decoded const &reference, std::size_t length,
+                         std::vector<Unit> const &units, conversion_result result) {
+        std::vector<Unit> const expected = encode<Unit>(reference.codepoints);
+        bool const agree = result.read == reference.read && result.written == expected.size() &&
+                           std::equal(expected.begin(), expected.end(), units.begin()) &&
+                           (reference.read < length || units.size() == expected.size());
+        if(!agree) {
+            out << "reference mismatch " << kernel << '\n';
+        }
+    }
+
+    template <typename Unit>
+    bool check_ascii(std::ostream &out, std::vector<Unit> const &str) {
+        bool const ascii = std::all_of(str.begin(), str.end(), [](Unit unit) {
+            return static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<Unit>>(unit)) < 0x80;
+        });
+        if(is_ascii(str.data(), str.size()) != ascii) {
+            out << "reference mismatch is_ascii\n";
+        }
+
+        return ascii;
+    }
+
+    /*
+     * Breaks the buffer at a random position, one time in two, with one of the given ill-formed sequences or by
+     * overwriting a unit with a random value.
+     */
+    template <typename Unit>
+    void corrupt(std::mt19937 &random, std::vector<Unit> &units, std::vector<std::vector<Unit>> const &ill_formed,
+                 std::uint32_t unit_range) {
+        if(random() % 2 == 0) {
+            return;
+        }
+        std::size_t const pos = units.empty() ? 0 : random() % (units.size() + 1);
+        std::size_t const choice = random() % (ill_formed.size() + 1);
+        if(choice == ill_formed.size() && pos < units.size()) {
+            units[pos] = static_cast<Unit>(random() % unit_range);
+        } else if(choice < ill_formed.size()) {
+            units.insert(units.begin() + pos, ill_formed[choice].begin(), ill_formed[choice].end());
+        }
+        if(units.size() > longest_buffer) {
+            units.resize(longest_buffer);
+        }
+    }
+
+    std::vector<char> bytes(std::initializer_list<unsigned> values) {
+        std::vector<char> out;
+        for(unsigned value : values) {
+            out.push_back(static_cast<char>(value));
+        }
+
+        return out;
+    }
+
+    void dump_utf8(std::ostream &out, std::vector<char> const &str) {
+        std::size_t const length = str.size();
+        decoded const reference = reference_decode(str);
+        out << "validate_utf8 " << validate_utf8(str.data(), length) << '\n';
+        if(validate_utf8(str.data(), length) != (reference.read == length)) {
+            out << "reference mismatch validate_utf8\n";
+        }
+        out << "is_ascii_utf8 " << is_ascii(str.data(), length) << '\n';
+        bool const ascii = check_ascii(out, str);
+
+        std::vector<char16_t> utf16(utf16_length_from_utf8(str.data(), length));
+        bool length_ascii = !ascii;
+        if(utf16_length_from_utf8(str.data(), length, length_ascii) != utf16.size() || length_ascii != ascii) {
+            out << "reference mismatch utf16_length_from_utf8\n";
+        }
+        auto result = convert_utf8_to_utf16(str.data(), length, utf16.data());
+        out << "convert_utf8_to_utf16 " << conversion(utf16, length, result) << '\n';
+        check_reference(out, "convert_utf8_to_utf16", reference, length, utf16, result);
+
+        std::vector<char32_t> utf32(utf32_length_from_utf8(str.data(), length));
+        length_ascii = !ascii;
+        if(utf32_length_from_utf8(str.data(), length, length_ascii) != utf32.size() || length_ascii != ascii) {
+            out << "reference mismatch utf32_length_from_utf8\n";
+        }
+        result = convert_utf8_to_utf32(str.data(), length, utf32.data());
+        out << "convert_utf8_to_utf32 " << conversion(utf32, length, result) << '\n';
+        check_reference(out, "convert_utf8_to_utf32", reference, length, utf32, result);
+
+        for(auto encoding : {legacy_encoding::latin1, legacy_encoding::windows1252}) {
+            std::vector<char> legacy(length);
+            result = convert_utf8_to_legacy(encoding, str.data(), length, legacy.data());
+            out << "convert_utf8_to_legacy " << result.read << ' ' << result.written << ' '
+                << digest(legacy, result.written) << '\n';
+        }
+
+        if(length == 0 || (static_cast<unsigned char>(str[0]) & 0xC0) != 0x80) {
+            for(std::size_t count : {std::size_t(0), std::size_t(1), std::size_t(17), length / 3, length}) {
+                out << "advance_utf8 " << count << ' ' << advance_utf8(str.data(), length, count) << '\n';
+            }
+        }
+        for(unsigned bound : {0x80, 0xC3, 0xE0, 0xF0}) {
+            out << "length_below_utf8 " << bound << ' '
+                << length_below(str.data(), length, static_cast<unsigned char>(bound)) << '\n';
+        }
+    }
+
+    void dump_utf16(std::ostream &out, std::vector<char16_t> const &str) {
+        std::size_t const length = str.size();
+        decoded const reference = reference_decode(str);
+        out << "is_ascii_utf16 " << is_ascii(str.data(), length) << '\n';
+        check_ascii(out, str);
+
+        std::vector<char32_t> utf32(utf32_length_from_utf16(str.data(), length));
+        auto result = convert_utf16_to_utf32(str.data(), length, utf32.data());
+        out << "convert_utf16_to_utf32 " << conversion(utf32, length, result) << '\n';
+        check_reference(out, "convert_utf16_to_utf32", reference, length, utf32, result);
+
+        std::vector<char> utf8(utf8_length_from_utf16(str.data(), length));
+        result = convert_utf16_to_utf8(str.data(), length, utf8.data());
+        out << "convert_utf16_to_utf8 " << conversion(utf8, length, result) << '\n';
+        check_reference(out, "convert_utf16_to_utf8", reference, length, utf8, result);
+
+        for(auto encoding : {legacy_encoding::latin1, legacy_encoding::windows1252}) {
+            std::vector<char> legacy(length);
+            result = convert_utf16_to_legacy(encoding, str.data(), length, legacy.data());
+            out << "convert_utf16_to_legacy " << result.read << ' ' << result.written << ' '
+                << digest(legacy, result.written) << '\n';
+        }
+
+        if(length == 0 || (str[0] & 0xFC00) != 0xDC00) {
+            for(std::size_t count : {std::size_t(0), std::size_t(1), std::size_t(17), length / 3, length}) {
+                out << "advance_utf16 " << count << ' ' << advance_utf16(str.data(), length, count) << '\n';
+            }
+        }
+        for(unsigned bound : {0x80, 0x100, 0x800, 0xD800}) {
+            out << "length_below_utf16 " << bound << ' ' << length_below(str.data(), length, static_cast<char16_t>(bound))
+                << '\n';
+        }
+    }
+
+    void dump_utf32(std::ostream &out, std::vector<char32_t> const &str) {
+        std::size_t const length = str.size();
+        decoded const reference = reference_decode(str);
+        out << "is_ascii_utf32 " << is_ascii(str.data(), length) << '\n';
+        check_ascii(out, str);
+
+        std::vector<char16_t> utf16(utf16_length_from_utf32(str.data(), length));
+        auto result = convert_utf32_to_utf16(str.data(), length, utf16.data());
+        out << "convert_utf32_to_utf16 " << conversion(utf16, length, result) << '\n';
+        check_reference(out, "convert_utf32_to_utf16", reference, length, utf16, result);
+
+        std::vector<char> utf8(utf8_length_from_utf32(str.data(), length));
+        result = convert_utf32_to_utf8(str.data(), length, utf8.data());
+        out << "convert_utf32_to_utf8 " << conversion(utf8, length, result) << '\n';
+        check_reference(out, "convert_utf32_to_utf8", reference, length, utf8, result);
+
+        for(auto encoding : {legacy_encoding::latin1, legacy_encoding::windows1252}) {
+            std::vector<char> legacy(length);
+            result = convert_utf32_to_legacy(encoding, str.data(), length, legacy.data());
+            out << "convert_utf32_to_legacy " << result.read << ' ' << result.written << ' '
+                << digest(legacy, result.written) << '\n';
+        }
+
+        for(char32_t bound : {0x80u, 0x800u, 0x10000u}) {
+            out << "length_below_utf32 " << bound << ' ' << length_below(str.data(), length, bound) << '\n';
+        }
+    }
+
+    void dump_legacy(std::ostream &out, std::vector<char> const &str) {
+        std::size_t const length = str.size();
+        for(auto encoding : {legacy_encoding::latin1, legacy_encoding::windows1252}) {
+            std::vector<char> utf8(utf8_length_from_legacy(encoding, str.data(), length));
+            std::size_t const written = convert_legacy_to_utf8(encoding, str.data(), length, utf8.data());
+            out << "convert_legacy_to_utf8 " << utf8.size() << ' ' << written << ' ' << digest(utf8, written) << '\n';
+
+            std::vector<char16_t> utf16(length);
+            convert_legacy_to_utf16(encoding, str.data(), length, utf16.data());
+            std::vector<char32_t> utf32(length);
+            convert_legacy_to_utf32(encoding, str.data(), length, utf32.data());
+            out << "convert_legacy_to_utf16_utf32 " << digest(utf16, length) << ' ' << digest(utf32, length) << '\n';
+        }
+    }
+
+    /*
+     * Prints the result of every kernel on the corpus, generated from a fixed seed so that every run sees the same.
+     */
+    void dump(std::ostream &out) {
+        std::vector<std::vector<char>> const ill_formed_utf8 = {
+            bytes({0x80}),       bytes({0xFF}),       bytes({0xC0, 0x80}),       bytes({0xC3}),
+            bytes({0xE2, 0x82}), bytes({0xED, 0xA0, 0x80}), bytes({0xF4, 0x90, 0x80, 0x80}), bytes({0xF0, 0x9F, 0x98})};
+        std::vector<std::vector<char16_t>> const ill_formed_utf16 = {{0xD800}, {0xDC00}, {0xDBFF, 0x41}};
+        std::vector<std::vector<char32_t>> const ill_formed_utf32 = {{0xD800}, {0x110000}, {0xFFFFFFFF}};
+
+        std::mt19937 random(20151022);
+        for(int i = 0; i < corpus_size; ++i) {
+            std::vector<char32_t> const text = random_text(random);
+
+            std::vector<char> utf8 = encode_utf8(text);
+            corrupt(random, utf8, ill_formed_utf8, 0x100);
+            utf8.resize(std::min(utf8.size(), longest_buffer));
+            utf8.shrink_to_fit();
+            out << "case " << i << " utf8 " << utf8.size() << '\n';
+            dump_utf8(out, utf8);
+
+            std::vector<char16_t> utf16 = encode_utf16(text);
+            corrupt(random, utf16, ill_formed_utf16, 0x10000);
+            utf16.shrink_to_fit();
+            out << "case " << i << " utf16 " << utf16.size() << '\n';
+            dump_utf16(out, utf16);
+
+            std::vector<char32_t> utf32 = text;
+            corrupt(random, utf32, ill_formed_utf32, 0x120000);
+            utf32.shrink_to_fit();
+            out << "case " << i << " utf32 " << utf32.size() << '\n';
+            dump_utf32(out, utf32);
+
+            std::vector<char> legacy(random() % (longest_buffer + 1));
+            for(char &byte : legacy) {
+                byte = static_cast<char>(random() % 4 == 0 ? random() % 0x100 : random() % 0x80);
+            }
+            out << "case " << i << " legacy " << legacy.size() << '\n';
+            dump_legacy(out, legacy);
+        }
+    }
+
+    /*
+     * Runs this program with --dump and UNISTRING_ISA set to the given level, and returns the ISA it ran with followed
+     * by its dump, one line each.
+     */
+    std::vector<std::string> run_dump(std::string const &program, char const *isa) {
+        std::string const command = std::string("UNISTRING_ISA=") + isa + " '" + program + "' --dump";
+        std::vector<std::string> lines;
+        FILE *pipe = popen(command.c_str(), "r");
+        if(pipe == nullptr) {
+            return lines;
+        }
+        std::string line;
+        for(int c; (c = std::fgetc(pipe)) != EOF;) {
+            if(c == '\n') {
+                lines.push_back(line);
+                line.clear();
+            } else {
+                line.push_back(static_cast<char>(c));
+            }
+        }
+        if(pclose(pipe) != 0) {
+            lines.clear();
+        }
+
+        return lines;
+    }
+}
+
+int main(int argc, char **argv) {
+    if(argc > 1 && std::string(argv[1]) == "--dump") {
+        std::ostringstream out;
+        out << active_isa() << '\n';
+        dump(out);
+        std::fputs(out.str().c_str(), stdout);
+        return 0;
+    }
+
+    std::vector<std::string> const reference = run_dump(argv[0], "scalar");
+    if(reference.empty() || reference[0] != "scalar") {
+        std::fprintf(stderr, "FAILED: could not run the scalar kernels\n");
+        return 1;
+    }
+
+    // The other levels are compared with the scalar one, so only its dump needs checking against the reference.
+    int failures = 0;
+    std::string reference_case;
+    for(std::string const &line : reference) {
+        if(line.compare(0, 5, "case ") == 0) {
+            reference_case = line;
+        }
+        if(line.find("overflows") != std::string::npos || line.compare(0, 18, "reference mismatch") == 0) {
+            std::fprintf(stderr, "FAILED: scalar kernels, %s: \"%s\"\n", reference_case.c_str(), line.c_str());
+            if(++failures == 10) {
+                break;
+            }
+        }
+    }
+    for(char const *isa : {"sse41", "avx2"}) {
+        std::vector<std::string> const lines = run_dump(argv[0], isa);
+        if(lines.empty()) {
+            std::fprintf(stderr, "FAILED: could not run the %s kernels\n", isa);
+            ++failures;
+            continue;
+        }
+        if(lines[0] == "scalar") {
+            continue;
+        }
+        // A CPU without AVX2 runs the SSE4.1 kernels again, which is harmless.
+        std::string current_case;
+        for(std::size_t i = 1; i < std::max(lines.size(), reference.size()); ++i) {
+            std::string const line = i < lines.size() ? lines[i] : "(missing)";
+            std::string const expected = i < reference.size() ? reference[i] : "(missing)";
+            if(expected.compare(0, 5, "case ") == 0) {
+                current_case = expected;
+            }
+            if(line != expected) {
+                std::fprintf(stderr, "FAILED: %s kernels, %s: got \"%s\", expected \"%s\"\n", lines[0].c_str(),
+                             current_case.c_str(), line.c_str(), expected.c_str());
+                ++failures;
+                break;
+            }
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,476 @@
+//
+//  unistring_normalizer_test.cpp
+//
+//  Differential checks of unistring_normalizer against utf8proc_map, and of its parallel normalization against the
+//  serial one, and checks of unistring_normalization_cache. Returns a non-zero status if any fails.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "unistring_normalizer.h"
+
+namespace {
+    int failures = 0;
+
+    void check(bool condition, char const *what) {
+        if(!condition) {
+            std::fprintf(stderr, "FAILED: %s\n", what);
+            ++failures;
+        }
+    }
+
+#define CHECK(condition) check((condition), #condition)
+
+    unistring_normalization_form const forms[] = {
+        unistring_normalization_form::nfc, unistring_normalization_form::nfd, unistring_normalization_form::nfkc,
+        unistring_normalization_form::nfkd, unistring_normalization_form::nfkc_casefold};
+
+    char const *const form_names[] = {"NFC", "NFD", "NFKC", "NFKD", "NFKC_Casefold"};
+
+    /*
+     * The utf8proc_map options of each form, in the order of forms.
+     */
+    int const map_options[] = {
+        UTF8PROC_STABLE | UTF8PROC_COMPOSE,
+        UTF8PROC_STABLE | UTF8PROC_DECOMPOSE,
+        UTF8PROC_STABLE | UTF8PROC_COMPOSE | UTF8PROC_COMPAT,
+        UTF8PROC_STABLE | UTF8PROC_DECOMPOSE | UTF8PROC_COMPAT,
+        UTF8PROC_STABLE | UTF8PROC_COMPOSE | UTF8PROC_COMPAT | UTF8PROC_CASEFOLD | UTF8PROC_IGNORE};
+
+    std::string reference_normalization(std::string const &str, int form) {
+        utf8proc_uint8_t *mapped = nullptr;
+        utf8proc_ssize_t const length = utf8proc_map(reinterpret_cast<utf8proc_uint8_t const *>(str.data()),
+                                                     static_cast<utf8proc_ssize_t>(str.size()), &mapped,
+                                                     static_cast<utf8proc_option_t>(map_options[form]));
+        if(length < 0) {
+            std::fprintf(stderr, "utf8proc_map: %s\n", utf8proc_errmsg(length));
+            std::exit(2);
+        }
+        std::string result(reinterpret_cast<char const *>(mapped), static_cast<std::size_t>(length));
+        std::free(mapped);
+
+        return result;
+    }
+
+    /*
+     * Encoders of their own, so that the conversions under test are not involved.
+     */
+    void append_codepoint(std::string &out, char32_t codepoint) {
+        utf8proc_uint8_t units[4];
+        out.append(reinterpret_cast<char const *>(units),
+                   static_cast<std::size_t>(utf8proc_encode_char(static_cast<utf8proc_int32_t>(codepoint), units)));
+    }
+
+    void append_codepoint(std::u16string &out, char32_t codepoint) {
+        if(codepoint < 0x10000) {
+            out.push_back(static_cast<char16_t>(codepoint));
+        } else {
+            out.push_back(static_cast<char16_t>(0xD800 + ((codepoint - 0x10000) >> 10)));
+            out.push_back(static_cast<char16_t>(0xDC00 + (codepoint & 0x3FF)));
+        }
+    }
+
+    void append_codepoint(std::u32string &out, char32_t codepoint) {
+        out.push_back(codepoint);
+    }
+
+    template <typename String>
+    String encode(std::u32string const &codepoints) {
+        String result;
+        for(char32_t codepoint : codepoints) {
+            append_codepoint(result, codepoint);
+        }
+
+        return result;
+    }
+
+    std::u32string decode(std::string const &str) {
+        std::u32string result;
+        auto const *units = reinterpret_cast<utf8proc_uint8_t const *>(str.data());
+        for(std::size_t pos = 0; pos < str.size();) {
+            utf8proc_int32_t codepoint;
+            pos += static_cast<std::size_t>(
+                utf8proc_iterate(units + pos, static_cast<utf8proc_ssize_t>(str.size() - pos), &codepoint));
+            result.push_back(static_cast<char32_t>(codepoint));
+        }
+
+        return result;
+    }
+
+    /*
+     * Normalizes the code points in every encoding and compares the outputs with expected, appended to a prefix
+     * that must be kept.
+     */
+    template <typename String>
+    bool normalizes_to(unistring_normalizer &normalizer, std::u32string const &codepoints,
+                       std::u32string const &expected) {
+        String const input = encode<String>(codepoints);
+        String out = encode<String>(U"prefix");
+        return normalizer.normalize(input.data(), input.size(), out) && out == encode<String>(U"prefix" + expected);
+    }
+
+    int failing_cases = 0;
+
+    void check_against_reference(std::u32string const &codepoints, char const *what) {
+        std::string const utf8 = encode<std::string>(codepoints);
+        for(int form = 0; form < 5; ++form) {
+            unistring_normalizer normalizer(forms[form]);
+            std::u32string const expected = decode(reference_normalization(utf8, form));
+            bool const agree = normalizes_to<std::string>(normalizer, codepoints, expected) &&
+                               normalizes_to<std::u16string>(normalizer, codepoints, expected) &&
+                               normalizes_to<std::u32string>(normalizer, codepoints, expected);
+            if(!agree && ++failing_cases <= 10) {
+                std::fprintf(stderr, "FAILED: %s differs from utf8proc_map in %s:", form_names[form], what);
+                for(char32_t codepoint : codepoints) {
+                    std::fprintf(stderr, " %04X", static_cast<unsigned>(codepoint));
+                }
+                std::fprintf(stderr, "\n");
+            }
+            failures += !agree;
+        }
+    }
+
+    /*
+     * Code points that exercise every step of the normalization: starters that compose or not, combining marks of
+     * several classes, Hangul jamo and syllables, compatibility and case folding mappings, default ignorables,
+     * composition exclusions and singletons. U+11A7, on which utf8proc_map is known to differ, is left to its own
+     * check.
+     */
+    char32_t const alphabet[] = {
+        U'a', U'e', U'o', U'A', U'Z', U' ', U'.', 0x00C5, 0x00E9, 0x00BD, 0x00DF, 0x00AD, 0x0300, 0x0301, 0x0308,
+        0x0316, 0x031B, 0x0323, 0x0327, 0x0345, 0x0390, 0x03A3, 0x03C2, 0x05B0, 0x0958, 0x0F73, 0x0F71, 0x0F72,
+        0x1100, 0x1112, 0x1161, 0x1175, 0x11A8, 0x11C2, 0xAC00, 0xAC01, 0xD7A3, 0x1E0A, 0x1E9E, 0x200B, 0x212B,
+        0x2126, 0x2460, 0xFB01, 0xFF21, 0x3099, 0x304B, 0x1F600, 0x1D15E, 0x2F800};
+
+    void test_random_text() {
+        std::mt19937 random(20151017);
+        std::uniform_int_distribution<std::size_t> pick(0, sizeof(alphabet) / sizeof(*alphabet) - 1);
+        std::uniform_int_distribution<std::size_t> length(0, 24);
+        for(int i = 0; i < 3000; ++i) {
+            std::u32string codepoints;
+            for(std::size_t n = length(random); n > 0; --n) {
+                codepoints.push_back(alphabet[pick(random)]);
+            }
+            check_against_reference(codepoints, "random text");
+        }
+    }
+
+    /*
+     * Combining sequences longer than the stack buffer of a segment spill to the heap storage of the normalizer.
+     */
+    void test_long_combining_runs() {
+        char32_t const marks[] = {0x0301, 0x0316, 0x0327, 0x0345, 0x0308, 0x05B0, 0x031B, 0x0F71};
+        std::mt19937 random(11);
+        for(std::size_t length : {31, 32, 33, 64, 200, 1000}) {
+            std::u32string codepoints = U"xe";
+            for(std::size_t i = 0; i < length; ++i) {
+                codepoints.push_back(marks[random() % (sizeof(marks) / sizeof(*marks))]);
+            }
+            codepoints += U"Ǻo";
+            check_against_reference(codepoints, "long combining run");
+            check_against_reference(codepoints + codepoints, "long combining runs");
+        }
+    }
+
+    /*
+     * Hangul syllables compose from their jamo and with a trailing jamo that follows, but an LVT syllable does not
+     * take another one.
+     */
+    void test_hangul() {
+        for(std::u32string const &codepoints :
+            {std::u32string(U"\u1100\u1161"), std::u32string(U"\u1100\u1161\u11A8"),
+             std::u32string(U"\uAC00\u11A8"), std::u32string(U"\uAC01\u11A8"), std::u32string(U"\uD7A3\u11C2"),
+             std::u32string(U"\u1100\u1161\u0301\u11A8"), std::u32string(U"a\uAC1B\u11A8b\uD788\u1161")}) {
+            check_against_reference(codepoints, "Hangul");
+        }
+    }
+
+    /*
+     * U+11A7 is no trailing jamo: an LV syllable followed by it stays as is, where utf8proc_map drops it.
+     */
+    void test_hangul_filler_divergence() {
+        for(int form : {0, 2, 4}) {
+            unistring_normalizer normalizer(forms[form]);
+            CHECK(normalizes_to<std::string>(normalizer, U"\uAC00\u11A7", U"\uAC00\u11A7"));
+            CHECK(normalizes_to<std::u16string>(normalizer, U"\u1100\u1161\u11A7", U"\uAC00\u11A7"));
+            CHECK(normalizes_to<std::u32string>(normalizer, U"\u1100\u1161\u11A7", U"\uAC00\u11A7"));
+            CHECK(decode(reference_normalization(encode<std::string>(U"\uAC00\u11A7"), form)) == U"\uAC00");
+        }
+        unistring_normalizer nfd(unistring_normalization_form::nfd);
+        CHECK(normalizes_to<std::string>(nfd, U"\uAC00\u11A7", U"\u1100\u1161\u11A7"));
+    }
+
+    /*
+     * An ill-formed buffer is rejected, leaving the output as it was.
+     */
+    void test_ill_formed() {
+        for(unistring_normalization_form form : forms) {
+            unistring_normalizer normalizer(form);
+            std::string out8 = "kept";
+            CHECK(!normalizer.normalize("e\xCC\x81\xFF", 4, out8) && out8 == "kept");
+            std::u16string out16 = u"kept";
+            std::u16string const lone(u"é\xDC00");
+            CHECK(!normalizer.normalize(lone.data(), lone.size(), out16) && out16 == u"kept");
+            std::u32string out32 = U"kept";
+            std::u32string const surrogate = {U'e', 0x0301, 0xD800};
+            CHECK(!normalizer.normalize(surrogate.data(), surrogate.size(), out32) && out32 == U"kept");
+        }
+    }
+    /*
+     * normalize_parallel cuts the buffer into chunks of at least 64 Ki units; its output must be that of normalize
+     * wherever the cuts fall, and an ill-formed sequence in any chunk must fail the whole call.
+     */
+    template <typename String>
+    void check_parallel(std::u32string const &codepoints, char const *what) {
+        String const input = encode<String>(codepoints);
+        for(unistring_normalization_form form : forms) {
+            unistring_normalizer normalizer(form);
+            String serial;
+            CHECK(normalizer.normalize(input.data(), input.size(), serial));
+            for(unsigned threads : {2u, 3u, 8u}) {
+                String parallel = encode<String>(U"prefix");
+                bool const normalized = normalizer.normalize_parallel(input.data(), input.size(), parallel, threads);
+                if(!normalized || parallel != encode<String>(U"prefix") + serial) {
+                    std::fprintf(stderr, "FAILED: normalize_parallel on %u threads differs in %s\n", threads, what);
+                    ++failures;
+                }
+            }
+
+            String ill_formed = input;
+            ill_formed[ill_formed.size() / 2 + 3] = static_cast<typename String::value_type>(0xD800);
+            ill_formed[ill_formed.size() / 2 + 4] = static_cast<typename String::value_type>(0xFF);
+            String out = encode<String>(U"kept");
+            CHECK(!normalizer.normalize_parallel(ill_formed.data(), ill_formed.size(), out, 4));
+            CHECK(out == encode<String>(U"kept"));
+        }
+    }
+
+    void test_parallel() {
+        std::mt19937 random(7);
+        std::uniform_int_distribution<std::size_t> pick(0, sizeof(alphabet) / sizeof(*alphabet) - 1);
+        std::u32string text;
+        while(text.size() < (std::size_t(5) << 16)) {
+            text.push_back(alphabet[pick(random)]);
+        }
+        std::u32string marks;
+        while(marks.size() < (std::size_t(3) << 16)) {
+            marks += (marks.size() / 1000) % 2 ? U"\u0301\u0316" : U"e\u0327\u0345\u0308";
+        }
+        for(auto const &input : {std::make_pair(text, "random text"), std::make_pair(marks, "combining runs")}) {
+            check_parallel<std::string>(input.first, input.second);
+            check_parallel<std::u16string>(input.first, input.second);
+            check_parallel<std::u32string>(input.first, input.second);
+        }
+
+        // Concurrent calls share the threads of the pool.
+        std::string const utf8 = encode<std::string>(text);
+        std::string expected;
+        unistring_normalizer(unistring_normalization_form::nfkc).normalize(utf8.data(), utf8.size(), expected);
+        std::vector<std::thread> callers;
+        bool agree[4] = {};
+        for(bool &result : agree) {
+            callers.emplace_back([&utf8, &expected, &result] {
+                result = true;
+                for(int i = 0; i < 4; ++i) {
+                    std::string out;
+                    unistring_normalizer normalizer(unistring_normalization_form::nfkc);
+                    result = result && normalizer.normalize_parallel(utf8.data(), utf8.size(), out, 3) && out == expected;
+                }
+            });
+        }
+        for(std::thread &caller : callers) {
+            caller.join();
+        }
+        for(bool result : agree) {
+            CHECK(result);
+        }
+    }
+    /*
+     * A string the quick check does not pass for NFC, so that it goes through the cache.
+     */
+    std::string cached_string(int i) {
+        return "e\xCC\x81" + std::to_string(i);
+    }
+
+    /*
+     * Whether the cache answers the lookup of str from its entries, leaving the normalization in out.
+     */
+    template <typename CharType>
+    bool hits(unistring_normalization_cache<CharType> &cache, std::basic_string<CharType> const &str) {
+        std::uint64_t const before = cache.hits();
+        std::basic_string<CharType> out;
+        bool const normalized = cache.normalize(str.data(), str.size(), out);
+        return normalized && cache.hits() == before + 1;
+    }
+
+    bool hits(unistring_normalization_cache<char> &cache, int i) {
+        return hits(cache, cached_string(i));
+    }
+
+    void test_cache_capacity() {
+        unistring_normalization_cache<char> cache(4, unistring_normalization_form::nfc, 1);
+        for(int i = 0; i < 10; ++i) {
+            std::string out;
+            CHECK(cache.normalize(cached_string(i).data(), cached_string(i).size(), out));
+            CHECK(out == "\xC3\xA9" + std::to_string(i));
+            CHECK(cache.size() == std::min<std::size_t>(i + 1, 4));
+        }
+        CHECK(cache.misses() == 10 && cache.hits() == 0);
+
+        // Fewer entries than shards leaves one entry per shard.
+        unistring_normalization_cache<char> sharded(5, unistring_normalization_form::nfc, 16);
+        for(int i = 0; i < 100; ++i) {
+            std::string out;
+            sharded.normalize(cached_string(i).data(), cached_string(i).size(), out);
+            CHECK(sharded.size() <= 5);
+        }
+    }
+
+    /*
+     * A full shard evicts the first entry from the hand on not hit since the hand last passed it, clearing the flag of
+     * those it passes.
+     */
+    void test_cache_eviction_order() {
+        unistring_normalization_cache<char> cache(3, unistring_normalization_form::nfc, 1);
+        CHECK(!hits(cache, 0) && !hits(cache, 1) && !hits(cache, 2));
+        CHECK(hits(cache, 0));
+        CHECK(!hits(cache, 3));
+        CHECK(cache.size() == 3);
+        CHECK(hits(cache, 0) && hits(cache, 2) && hits(cache, 3));
+        CHECK(!hits(cache, 1));
+
+        // Entry 1 took the slot of entry 2, and the hand is back on entry 0. Once every entry is hit, the hand clears
+        // all the flags and comes back to evict where it started.
+        CHECK(hits(cache, 0) && hits(cache, 1) && hits(cache, 3));
+        CHECK(!hits(cache, 4));
+        CHECK(hits(cache, 1) && hits(cache, 3) && hits(cache, 4));
+        CHECK(!hits(cache, 0));
+    }
+
+    /*
+     * The shard of a string is its FNV-1a hash over its units modulo the number of shards, each holding its share of
+     * the capacity: strings of the same shard evict each other, while other shards keep theirs.
+     */
+    void test_cache_shards() {
+        auto const shard_of = [](std::string const &str) {
+            std::uint64_t hash = 0xCBF29CE484222325;
+            for(char unit : str) {
+                hash = (hash ^ static_cast<unsigned char>(unit)) * 0x100000001B3;
+            }
+            return static_cast<std::size_t>(hash) % 4;
+        };
+        int same = 1, other = 1;
+        while(shard_of(cached_string(same)) != shard_of(cached_string(0))) {
+            ++same;
+        }
+        while(shard_of(cached_string(other)) == shard_of(cached_string(0))) {
+            ++other;
+        }
+
+        unistring_normalization_cache<char> cache(4, unistring_normalization_form::nfc, 4);
+        CHECK(!hits(cache, 0) && !hits(cache, other));
+        CHECK(!hits(cache, same));
+        CHECK(cache.size() == 2);
+        CHECK(hits(cache, other) && hits(cache, same));
+        CHECK(!hits(cache, 0));
+    }
+
+    /*
+     * The strings the quick check finds normalized are returned as is without being counted or cached, and the
+     * ill-formed ones fail without being cached.
+     */
+    void test_cache_bypass() {
+        unistring_normalization_cache<char> cache(8, unistring_normalization_form::nfc);
+        std::string out = "x";
+        CHECK(cache.normalize("caf\xC3\xA9", 5, out) && out == "xcaf\xC3\xA9");
+        CHECK(cache.hits() == 0 && cache.misses() == 0 && cache.size() == 0);
+
+        CHECK(!cache.normalize("e\xCC\x81\xFF", 4, out) && out == "xcaf\xC3\xA9");
+        CHECK(cache.size() == 0);
+        CHECK(!cache.normalize("e\xCC\x81\xFF", 4, out));
+
+        unistring_normalization_cache<char32_t> casefold(8, unistring_normalization_form::nfkc_casefold);
+        std::u32string folded;
+        CHECK(casefold.normalize(U"abc", 3, folded) && folded == U"abc");
+        CHECK(casefold.normalize(U"ABC", 3, folded) && folded == U"abcabc");
+        CHECK(casefold.misses() == 1 && casefold.size() == 1);
+    }
+
+    void test_cache_clear() {
+        unistring_normalization_cache<char> cache(8, unistring_normalization_form::nfc, 2);
+        CHECK(!hits(cache, 0) && !hits(cache, 1) && hits(cache, 0));
+        cache.clear();
+        CHECK(cache.size() == 0);
+        CHECK(cache.hits() == 1 && cache.misses() == 2);
+        CHECK(!hits(cache, 0) && hits(cache, 0));
+        CHECK(cache.hits() == 2 && cache.misses() == 3);
+    }
+
+    /*
+     * Threads sharing a cache smaller than the set of strings they normalize all get the right normalizations, and
+     * every lookup is counted once.
+     */
+    void test_cache_concurrency() {
+        std::vector<std::u16string> strings;
+        std::vector<std::u16string> expected;
+        for(int i = 0; i < 64; ++i) {
+            std::u32string codepoints = U"\u1100\u1161\u11A8";
+            for(char digit : std::to_string(i)) {
+                codepoints += static_cast<char32_t>(digit);
+                codepoints += U"\u0308";
+            }
+            strings.push_back(encode<std::u16string>(codepoints));
+            expected.emplace_back();
+            unistring_normalizer().normalize(strings.back().data(), strings.back().size(), expected.back());
+        }
+
+        unistring_normalization_cache<char16_t> cache(16, unistring_normalization_form::nfc, 4);
+        std::vector<std::thread> threads;
+        bool agree[8] = {};
+        for(unsigned t = 0; t < 8; ++t) {
+            threads.emplace_back([&, t] {
+                std::mt19937 random(t);
+                agree[t] = true;
+                for(int i = 0; i < 2000; ++i) {
+                    std::size_t const picked = random() % 24 < 20 ? random() % 8 : random() % strings.size();
+                    std::u16string out;
+                    agree[t] = agree[t] && cache.normalize(strings[picked].data(), strings[picked].size(), out) &&
+                               out == expected[picked];
+                }
+            });
+        }
+        for(std::thread &thread : threads) {
+            thread.join();
+        }
+        for(bool result : agree) {
+            CHECK(result);
+        }
+        CHECK(cache.hits() + cache.misses() == 8 * 2000);
+        CHECK(cache.hits() > 0);
+        CHECK(cache.size() <= 16);
+    }
+}
+
+int main() {
+    test_random_text();
+    test_long_combining_runs();
+    test_hangul();
+    test_hangul_filler_divergence();
+    test_ill_formed();
+    test_parallel();
+    test_cache_capacity();
+    test_cache_eviction_order();
+    test_cache_shards();
+    test_cache_bypass();
+    test_cache_clear();
+    test_cache_concurrency();
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,2723 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  unistring_kernels.cpp
+//
+
+#include "unistring_kernels.h"
+#include "utf8proc.h"
+#include <cstdint>
+#include <cstring>
+
+#include <cstdlib>
+#include <algorithm>
+
+// On x86, the SSE4.1 and AVX2 kernels are compiled whatever the target, each function enabling its instruction set
+// through an attribute, and the best one the CPU supports is picked at run time. The 128-bit building blocks in
+// sse_blocks are shared by both.
+#if(defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <cpuid.h>
+#include <immintrin.h>
+#define UNISTRING_HAS_X86_KERNELS 1
+#define UNISTRING_TARGET_SSE41 __attribute__((target("sse4.1,popcnt")))
+#define UNISTRING_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+// Forces the shared blocks into their callers, where they get the caller's encoding: an AVX2 kernel calling SSE code
+// would pay for the transitions between the two.
+#define UNISTRING_ALWAYS_INLINE __attribute__((always_inline))
+#endif
+
+namespace {
+    using unistring_kernels::conversion_result;
+
+    namespace scalar {
+        /**
+         * Decodes the UTF-8 sequence at the beginning of str and returns its length, or 0 if it is ill-formed.
+         * Accepts exactly what utf8proc_iterate accepts, but never reads past str + remaining.
+         */
+        inline std::size_t decode_utf8(std::uint8_t const *str, std::size_t remaining, char32_t &codepoint) {
+            std::uint32_t lead = str[0];
+            if(lead < 0x80) {
+                codepoint = lead;
+                return 1;
+            }
+
+            std::size_t length = utf8proc_utf8class[lead];
+            if(length < 2 || length > remaining || lead < 0xC2 || lead > 0xF4) {
+                return 0;
+            }
+            for(std::size_t i = 1; i < length; ++i) {
+                if((str[i] & 0xC0) != 0x80) {
+                    return 0;
+                }
+            }
+
+            switch(length) {
+                case 2:
+                    codepoint = ((lead & 0x1F) << 6) | (str[1] & 0x3F);
+                    return 2;
+                case 3:
+                    if((lead == 0xE0 && str[1] < 0xA0) || (lead == 0xED && str[1] > 0x9F)) {
+                        return 0;
+                    }
+                    codepoint = ((lead & 0x0F) << 12) | ((str[1] & 0x3F) << 6) | (str[2] & 0x3F);
+                    return 3;
+                default:
+                    if((lead == 0xF0 && str[1] < 0x90) || (lead == 0xF4 && str[1] > 0x8F)) {
+                        return 0;
+                    }
+                    codepoint = ((lead & 0x07) << 18) | ((str[1] & 0x3F) << 12) | ((str[2] & 0x3F) << 6) | (str[3] & 0x3F);
+                    return 4;
+            }
+        }
+
+        /**
+         * Decodes the sequence at the beginning of str, which must be valid UTF-8, and returns its length.
+         */
+        inline std::size_t decode_valid_utf8_sequence(std::uint8_t const *str, char32_t &codepoint) {
+            std::uint32_t const lead = str[0];
+            if(lead < 0x80) {
+                codepoint = lead;
+                return 1;
+            } else if(lead < 0xE0) {
+                codepoint = ((lead & 0x1F) << 6) | (str[1] & 0x3F);
+                return 2;
+            } else if(lead < 0xF0) {
+                codepoint = ((lead & 0x0F) << 12) | ((str[1] & 0x3F) << 6) | (str[2] & 0x3F);
+                return 3;
+            }
+            codepoint = ((lead & 0x07) << 18) | ((str[1] & 0x3F) << 12) | ((str[2] & 0x3F) << 6) | (str[3] & 0x3F);
+            return 4;
+        }
+
+        inline bool is_ascii_word(std::uint8_t const *str) {
+            std::uint64_t word;
+            std::memcpy(&word, str, sizeof(word));
+            return (word & 0x8080808080808080ULL) == 0;
+        }
+
+        bool validate_utf8(std::uint8_t const *str, std::size_t length) {
+            std::size_t pos = 0;
+            while(pos < length) {
+                if(pos + 8 <= length && is_ascii_word(str + pos)) {
+                    pos += 8;
+                    continue;
+                }
+                char32_t codepoint;
+                std::size_t consumed = decode_utf8(str + pos, length - pos, codepoint);
+                if(consumed == 0) {
+                    return false;
+                }
+                pos += consumed;
+            }
+
+            return true;
+        }
+    }
+
+    /*
+     * The vectorized validators classify every byte from its high nibble, the high nibble of its predecessor and
+     * the low nibble of its predecessor (three table lookups), which is enough to catch every error involving two
+     * consecutive bytes. The remaining errors (missing or excess 3rd and 4th bytes) are caught by comparing the
+     * positions that must be continuation bytes with the ones that actually are.
+     */
+    namespace utf8_tables {
+        constexpr std::uint8_t too_short = 1 << 0;
+        constexpr std::uint8_t too_long = 1 << 1;
+        constexpr std::uint8_t overlong_3 = 1 << 2;
+        constexpr std::uint8_t too_large = 1 << 3;
+        constexpr std::uint8_t surrogate = 1 << 4;
+        constexpr std::uint8_t overlong_2 = 1 << 5;
+        constexpr std::uint8_t too_large_1000 = 1 << 6;
+        constexpr std::uint8_t overlong_4 = 1 << 6;
+        constexpr std::uint8_t two_conts = 1 << 7;
+        constexpr std::uint8_t carry = too_short | too_long | two_conts;
+
+        alignas(16) constexpr std::uint8_t byte_1_high[16] = {
+            // 0_______ ________ <ASCII in byte 1>
+            too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+            // 10______ ________ <continuation in byte 1>
+            two_conts, two_conts, two_conts, two_conts,
+            // 1100____ ________ <two byte lead in byte 1>
+            too_short | overlong_2,
+            // 1101____ ________ <two byte lead in byte 1>
+            too_short,
+            // 1110____ ________ <three byte lead in byte 1>
+            too_short | overlong_3 | surrogate,
+            // 1111____ ________ <four+ byte lead in byte 1>
+            too_short | too_large | too_large_1000 | overlong_4,
+        };
+
+        alignas(16) constexpr std::uint8_t byte_1_low[16] = {
+            // ____0000 ________
+            carry | overlong_3 | overlong_2 | overlong_4,
+            // ____0001 ________
+            carry | overlong_2,
+            // ____001_ ________
+            carry, carry,
+            // ____0100 ________
+            carry | too_large,
+            // ____0101 ________ to ____1100 ________
+            carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+            // ____1101 ________
+            carry | too_large | too_large_1000 | surrogate,
+            // ____111_ ________
+            carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+        };
+
+        alignas(16) constexpr std::uint8_t byte_2_high[16] = {
+            // ________ 0_______ <ASCII in byte 2>
+            too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+            // ________ 1000____
+            too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+            // ________ 1001____
+            too_long | overlong_2 | two_conts | overlong_3 | too_large,
+            // ________ 101_____
+            too_long | overlong_2 | two_conts | surrogate | too_large,
+            too_long | overlong_2 | two_conts | surrogate | too_large,
+            // ________ 11______ <lead byte in byte 2>
+            too_short, too_short, too_short, too_short,
+        };
+
+        // A lead byte in one of the last 3 positions of a block needs bytes from the next block.
+        alignas(32) constexpr std::uint8_t incomplete_max[32] = {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF,
+        };
+    }
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace sse41 {
+        class utf8_checker {
+        public:
+            UNISTRING_TARGET_SSE41
+            utf8_checker()
+                    : _error(_mm_setzero_si128()), _prev_input(_mm_setzero_si128()), _prev_incomplete(_mm_setzero_si128()) {}
+
+            UNISTRING_TARGET_SSE41
+            void check_block(__m128i input) {
+                if(_mm_movemask_epi8(input) == 0) {
+                    _error = _mm_or_si128(_error, _prev_incomplete);
+                } else {
+                    this->check_multibyte(input);
+                    _prev_incomplete = _mm_subs_epu8(
+                        input, _mm_load_si128(reinterpret_cast<__m128i const *>(utf8_tables::incomplete_max + 16)));
+                }
+                _prev_input = input;
+            }
+
+            UNISTRING_TARGET_SSE41
+            bool finish() {
+                _error = _mm_or_si128(_error, _prev_incomplete);
+                return _mm_testz_si128(_error, _error);
+            }
+
+        private:
+            UNISTRING_TARGET_SSE41
+            void check_multibyte(__m128i input) {
+                __m128i const nibble = _mm_set1_epi8(0x0F);
+                __m128i const prev1 = _mm_alignr_epi8(input, _prev_input, 15);
+
+                __m128i const byte_1_high =
+                    _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<__m128i const *>(utf8_tables::byte_1_high)),
+                                     _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+                __m128i const byte_1_low =
+                    _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<__m128i const *>(utf8_tables::byte_1_low)),
+                                     _mm_and_si128(prev1, nibble));
+                __m128i const byte_2_high =
+                    _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<__m128i const *>(utf8_tables::byte_2_high)),
+                                     _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+                __m128i const special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+                __m128i const prev2 = _mm_alignr_epi8(input, _prev_input, 14);
+                __m128i const prev3 = _mm_alignr_epi8(input, _prev_input, 13);
+                __m128i const is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80));
+                __m128i const is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80));
+                __m128i const must_be_continuation =
+                    _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(static_cast<char>(0x80)));
+
+                _error = _mm_or_si128(_error, _mm_xor_si128(must_be_continuation, special));
+            }
+
+            __m128i _error;
+            __m128i _prev_input;
+            __m128i _prev_incomplete;
+        };
+
+        UNISTRING_TARGET_SSE41
+        bool validate_utf8(std::uint8_t const *str, std::size_t length) {
+            utf8_checker checker;
+            std::size_t pos = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                checker.check_block(_mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos)));
+            }
+            if(pos < length) {
+                alignas(16) std::uint8_t tail[16] = {};
+                std::memcpy(tail, str + pos, length - pos);
+                checker.check_block(_mm_load_si128(reinterpret_cast<__m128i const *>(tail)));
+            }
+
+            return checker.finish();
+        }
+    }
+#endif
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace avx2 {
+        UNISTRING_TARGET_AVX2
+        inline __m256i broadcast_table(std::uint8_t const *table) {
+            return _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<__m128i const *>(table)));
+        }
+
+        class utf8_checker {
+        public:
+            UNISTRING_TARGET_AVX2
+            utf8_checker()
+                    : _error(_mm256_setzero_si256()), _prev_input(_mm256_setzero_si256()), _prev_incomplete(_mm256_setzero_si256()) {}
+
+            UNISTRING_TARGET_AVX2
+            void check_block(__m256i input) {
+                if(_mm256_movemask_epi8(input) == 0) {
+                    _error = _mm256_or_si256(_error, _prev_incomplete);
+                } else {
+                    this->check_multibyte(input);
+                    _prev_incomplete = _mm256_subs_epu8(
+                        input, _mm256_load_si256(reinterpret_cast<__m256i const *>(utf8_tables::incomplete_max)));
+                }
+                _prev_input = input;
+            }
+
+            UNISTRING_TARGET_AVX2
+            bool finish() {
+                _error = _mm256_or_si256(_error, _prev_incomplete);
+                return _mm256_testz_si256(_error, _error);
+            }
+
+        private:
+            UNISTRING_TARGET_AVX2
+            void check_multibyte(__m256i input) {
+                __m256i const nibble = _mm256_set1_epi8(0x0F);
+                // The upper half of the previous block followed by the lower half of the current one.
+                __m256i const shifted = _mm256_permute2x128_si256(_prev_input, input, 0x21);
+                __m256i const prev1 = _mm256_alignr_epi8(input, shifted, 15);
+
+                __m256i const byte_1_high = _mm256_shuffle_epi8(broadcast_table(utf8_tables::byte_1_high),
+                                                                _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+                __m256i const byte_1_low =
+                    _mm256_shuffle_epi8(broadcast_table(utf8_tables::byte_1_low), _mm256_and_si256(prev1, nibble));
+                __m256i const byte_2_high = _mm256_shuffle_epi8(broadcast_table(utf8_tables::byte_2_high),
+                                                                _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+                __m256i const special = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+                __m256i const prev2 = _mm256_alignr_epi8(input, shifted, 14);
+                __m256i const prev3 = _mm256_alignr_epi8(input, shifted, 13);
+                __m256i const is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80));
+                __m256i const is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80));
+                __m256i const must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte),
+                                                                      _mm256_set1_epi8(static_cast<char>(0x80)));
+
+                _error = _mm256_or_si256(_error, _mm256_xor_si256(must_be_continuation, special));
+            }
+
+            __m256i _error;
+            __m256i _prev_input;
+            __m256i _prev_incomplete;
+        };
+
+        UNISTRING_TARGET_AVX2
+        bool validate_utf8(std::uint8_t const *str, std::size_t length) {
+            utf8_checker checker;
+            std::size_t pos = 0;
+            for(; pos + 32 <= length; pos += 32) {
+                checker.check_block(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos)));
+            }
+            if(pos < length) {
+                alignas(32) std::uint8_t tail[32] = {};
+                std::memcpy(tail, str + pos, length - pos);
+                checker.check_block(_mm256_load_si256(reinterpret_cast<__m256i const *>(tail)));
+            }
+
+            return checker.finish();
+        }
+    }
+#endif
+}
+
+// UTF-32 to UTF-16
+
+namespace {
+    namespace scalar {
+        std::size_t utf16_length_from_utf32(char32_t const *str, std::size_t length) {
+            std::size_t count = length;
+            for(std::size_t pos = 0; pos < length; ++pos) {
+                count += str[pos] > 0xFFFF;
+            }
+
+            return count;
+        }
+
+        conversion_result convert_utf32_to_utf16(char32_t const *str, std::size_t length, char16_t *out) {
+            std::size_t pos = 0, written = 0;
+            for(; pos < length; ++pos) {
+                char32_t codepoint = str[pos];
+                if(codepoint < 0x10000) {
+                    if((codepoint & 0xF800) == 0xD800) {
+                        break;
+                    }
+                    out[written++] = static_cast<char16_t>(codepoint);
+                } else if(codepoint < 0x110000) {
+                    codepoint -= 0x10000;
+                    out[written++] = static_cast<char16_t>(0xD800 + (codepoint >> 10));
+                    out[written++] = static_cast<char16_t>(0xDC00 + (codepoint & 0x3FF));
+                } else {
+                    break;
+                }
+            }
+
+            return {pos, written};
+        }
+    }
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace sse41 {
+        UNISTRING_TARGET_SSE41
+        std::size_t utf16_length_from_utf32(char32_t const *str, std::size_t length) {
+            __m128i const bmp_max = _mm_set1_epi32(0xFFFF);
+            std::size_t pos = 0, count = length;
+            for(; pos + 4 <= length; pos += 4) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(input, bmp_max))));
+            }
+
+            return count + scalar::utf16_length_from_utf32(str + pos, length - pos) - (length - pos);
+        }
+
+        UNISTRING_TARGET_SSE41
+        conversion_result convert_utf32_to_utf16(char32_t const *str, std::size_t length, char16_t *out) {
+            __m128i const high_half = _mm_set1_epi32(static_cast<int>(0xFFFF0000));
+            __m128i const surrogate_mask = _mm_set1_epi16(static_cast<short>(0xF800));
+            __m128i const surrogate_bits = _mm_set1_epi16(static_cast<short>(0xD800));
+
+            std::size_t pos = 0, written = 0;
+            while(pos + 8 <= length) {
+                __m128i const low = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                __m128i const high = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos + 4));
+                // Plain BMP block: narrowing is a saturating pack, provided no surrogate shows up.
+                if(_mm_testz_si128(_mm_or_si128(low, high), high_half)) {
+                    __m128i const packed = _mm_packus_epi32(low, high);
+                    if(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(packed, surrogate_mask), surrogate_bits)) == 0) {
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), packed);
+                        pos += 8;
+                        written += 8;
+                        continue;
+                    }
+                }
+
+                auto block = scalar::convert_utf32_to_utf16(str + pos, 8, out + written);
+                pos += block.read;
+                written += block.written;
+                if(block.read != 8) {
+                    return {pos, written};
+                }
+            }
+
+            auto tail = scalar::convert_utf32_to_utf16(str + pos, length - pos, out + written);
+            return {pos + tail.read, written + tail.written};
+        }
+    }
+#endif
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace avx2 {
+        UNISTRING_TARGET_AVX2
+        std::size_t utf16_length_from_utf32(char32_t const *str, std::size_t length) {
+            __m256i const bmp_max = _mm256_set1_epi32(0xFFFF);
+            std::size_t pos = 0, count = length;
+            for(; pos + 8 <= length; pos += 8) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                count += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(input, bmp_max))));
+            }
+
+            return count + scalar::utf16_length_from_utf32(str + pos, length - pos) - (length - pos);
+        }
+
+        UNISTRING_TARGET_AVX2
+        conversion_result convert_utf32_to_utf16(char32_t const *str, std::size_t length, char16_t *out) {
+            __m256i const high_half = _mm256_set1_epi32(static_cast<int>(0xFFFF0000));
+            __m256i const surrogate_mask = _mm256_set1_epi16(static_cast<short>(0xF800));
+            __m256i const surrogate_bits = _mm256_set1_epi16(static_cast<short>(0xD800));
+
+            std::size_t pos = 0, written = 0;
+            while(pos + 16 <= length) {
+                __m256i const low = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                __m256i const high = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos + 8));
+                if(_mm256_testz_si256(_mm256_or_si256(low, high), high_half)) {
+                    // The pack works within 128-bit lanes, so the 64-bit quarters come out as 0, 2, 1, 3.
+                    __m256i const packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), 0xD8);
+                    __m256i const surrogates = _mm256_cmpeq_epi16(_mm256_and_si256(packed, surrogate_mask), surrogate_bits);
+                    if(_mm256_movemask_epi8(surrogates) == 0) {
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written), packed);
+                        pos += 16;
+                        written += 16;
+                        continue;
+                    }
+                }
+
+                auto block = scalar::convert_utf32_to_utf16(str + pos, 16, out + written);
+                pos += block.read;
+                written += block.written;
+                if(block.read != 16) {
+                    return {pos, written};
+                }
+            }
+
+            auto tail = scalar::convert_utf32_to_utf16(str + pos, length - pos, out + written);
+            return {pos + tail.read, written + tail.written};
+        }
+    }
+#endif
+}
+
+// UTF-16 to UTF-32
+
+namespace {
+    namespace scalar {
+        /**
+         * Decodes the UTF-16 sequence at the beginning of str and returns its length, or 0 if it is an unpaired
+         * surrogate.
+         */
+        inline std::size_t decode_utf16(char16_t const *str, std::size_t remaining, char32_t &codepoint) {
+            char32_t const unit = str[0];
+            if((unit & 0xF800) != 0xD800) {
+                codepoint = unit;
+                return 1;
+            }
+            if(unit > 0xDBFF || remaining < 2 || (str[1] & 0xFC00) != 0xDC00) {
+                return 0;
+            }
+            codepoint = 0x10000 + ((unit - 0xD800) << 10) + (str[1] - 0xDC00);
+            return 2;
+        }
+
+        std::size_t utf32_length_from_utf16(char16_t const *str, std::size_t length) {
+            std::size_t count = length;
+            for(std::size_t pos = 0; pos < length; ++pos) {
+                count -= (str[pos] & 0xFC00) == 0xDC00;
+            }
+
+            return count;
+        }
+
+        conversion_result convert_utf16_to_utf32(char16_t const *str, std::size_t length, char32_t *out) {
+            std::size_t pos = 0, written = 0;
+            while(pos < length) {
+                char32_t codepoint;
+                std::size_t consumed = decode_utf16(str + pos, length - pos, codepoint);
+                if(consumed == 0) {
+                    break;
+                }
+                pos += consumed;
+                out[written++] = codepoint;
+            }
+
+            return {pos, written};
+        }
+    }
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace sse41 {
+        UNISTRING_TARGET_SSE41
+        std::size_t utf32_length_from_utf16(char16_t const *str, std::size_t length) {
+            __m128i const low_surrogate_mask = _mm_set1_epi16(static_cast<short>(0xFC00));
+            __m128i const low_surrogate_bits = _mm_set1_epi16(static_cast<short>(0xDC00));
+            std::size_t pos = 0, count = length;
+            for(; pos + 8 <= length; pos += 8) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                __m128i const low_surrogates = _mm_cmpeq_epi16(_mm_and_si128(input, low_surrogate_mask), low_surrogate_bits);
+                count -= __builtin_popcount(_mm_movemask_epi8(low_surrogates)) / 2;
+            }
+
+            return count - (length - pos) + scalar::utf32_length_from_utf16(str + pos, length - pos);
+        }
+
+        UNISTRING_TARGET_SSE41
+        conversion_result convert_utf16_to_utf32(char16_t const *str, std::size_t length, char32_t *out) {
+            __m128i const surrogate_mask = _mm_set1_epi16(static_cast<short>(0xF800));
+            __m128i const surrogate_bits = _mm_set1_epi16(static_cast<short>(0xD800));
+
+            std::size_t pos = 0, written = 0;
+            while(pos + 8 <= length) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                unsigned surrogates = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(input, surrogate_mask), surrogate_bits));
+                if(surrogates == 0) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), _mm_cvtepu16_epi32(input));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written + 4),
+                                     _mm_cvtepu16_epi32(_mm_srli_si128(input, 8)));
+                    pos += 8;
+                    written += 8;
+                    continue;
+                }
+
+                // Copy the units up to the first surrogate, then decode the pair that starts there.
+                for(std::size_t plain = __builtin_ctz(surrogates) / 2; plain > 0; --plain) {
+                    out[written++] = str[pos++];
+                }
+                char32_t codepoint;
+                std::size_t consumed = scalar::decode_utf16(str + pos, length - pos, codepoint);
+                if(consumed == 0) {
+                    return {pos, written};
+                }
+                pos += consumed;
+                out[written++] = codepoint;
+            }
+
+            auto tail = scalar::convert_utf16_to_utf32(str + pos, length - pos, out + written);
+            return {pos + tail.read, written + tail.written};
+        }
+    }
+#endif
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace avx2 {
+        UNISTRING_TARGET_AVX2
+        std::size_t utf32_length_from_utf16(char16_t const *str, std::size_t length) {
+            __m256i const low_surrogate_mask = _mm256_set1_epi16(static_cast<short>(0xFC00));
+            __m256i const low_surrogate_bits = _mm256_set1_epi16(static_cast<short>(0xDC00));
+            std::size_t pos = 0, count = length;
+            for(; pos + 16 <= length; pos += 16) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                __m256i const low_surrogates =
+                    _mm256_cmpeq_epi16(_mm256_and_si256(input, low_surrogate_mask), low_surrogate_bits);
+                count -= __builtin_popcount(_mm256_movemask_epi8(low_surrogates)) / 2;
+            }
+
+            return count - (length - pos) + scalar::utf32_length_from_utf16(str + pos, length - pos);
+        }
+
+        UNISTRING_TARGET_AVX2
+        conversion_result convert_utf16_to_utf32(char16_t const *str, std::size_t length, char32_t *out) {
+            __m256i const surrogate_mask = _mm256_set1_epi16(static_cast<short>(0xF800));
+            __m256i const surrogate_bits = _mm256_set1_epi16(static_cast<short>(0xD800));
+
+            std::size_t pos = 0, written = 0;
+            while(pos + 16 <= length) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                unsigned surrogates =
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(input, surrogate_mask), surrogate_bits));
+                if(surrogates == 0) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written),
+                                        _mm256_cvtepu16_epi32(_mm256_castsi256_si128(input)));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written + 8),
+                                        _mm256_cvtepu16_epi32(_mm256_extracti128_si256(input, 1)));
+                    pos += 16;
+                    written += 16;
+                    continue;
+                }
+
+                for(std::size_t plain = __builtin_ctz(surrogates) / 2; plain > 0; --plain) {
+                    out[written++] = str[pos++];
+                }
+                char32_t codepoint;
+                std::size_t consumed = scalar::decode_utf16(str + pos, length - pos, codepoint);
+                if(consumed == 0) {
+                    return {pos, written};
+                }
+                pos += consumed;
+                out[written++] = codepoint;
+            }
+
+            auto tail = scalar::convert_utf16_to_utf32(str + pos, length - pos, out + written);
+            return {pos + tail.read, written + tail.written};
+        }
+    }
+#endif
+}
+
+// UTF-8 to UTF-16
+
+namespace {
+    namespace scalar {
+        inline std::size_t encode_utf16(char32_t codepoint, char16_t *out) {
+            if(codepoint < 0x10000) {
+                out[0] = static_cast<char16_t>(codepoint);
+                return 1;
+            }
+            codepoint -= 0x10000;
+            out[0] = static_cast<char16_t>(0xD800 + (codepoint >> 10));
+            out[1] = static_cast<char16_t>(0xDC00 + (codepoint & 0x3FF));
+            return 2;
+        }
+
+        std::size_t utf16_length_from_utf8(std::uint8_t const *str, std::size_t length, bool &ascii) {
+            std::size_t count = 0;
+            std::uint8_t seen = 0;
+            for(std::size_t pos = 0; pos < length; ++pos) {
+                count += (str[pos] & 0xC0) != 0x80;
+                count += str[pos] >= 0xF0;
+                seen |= str[pos];
+            }
+            ascii = seen < 0x80;
+
+            return count;
+        }
+
+        conversion_result convert_utf8_to_utf16(std::uint8_t const *str, std::size_t length, char16_t *out) {
+            std::size_t pos = 0, written = 0;
+            while(pos < length) {
+                if(pos + 8 <= length && is_ascii_word(str + pos)) {
+                    for(std::size_t end = pos + 8; pos < end; ++pos) {
+                        out[written++] = str[pos];
+                    }
+                    continue;
+                }
+                char32_t codepoint;
+                std::size_t consumed = decode_utf8(str + pos, length - pos, codepoint);
+                if(consumed == 0) {
+                    break;
+                }
+                pos += consumed;
+                written += encode_utf16(codepoint, out + written);
+            }
+
+            return {pos, written};
+        }
+
+        inline std::size_t store_codepoint(char32_t codepoint, char16_t *out) {
+            return encode_utf16(codepoint, out);
+        }
+
+        inline std::size_t store_codepoint(char32_t codepoint, char32_t *out) {
+            *out = codepoint;
+            return 1;
+        }
+
+        /**
+         * Decodes the sequences of a valid UTF-8 buffer that start before str + end, skipping the continuation bytes
+         * found at its beginning, which belong to a sequence already decoded. Returns the position reached.
+         */
+        template <typename UnitType>
+        std::size_t
+            decode_valid_utf8(std::uint8_t const *str, std::size_t pos, std::size_t end, UnitType *out, std::size_t &written) {
+            while(pos < end && (str[pos] & 0xC0) == 0x80) {
+                ++pos;
+            }
+            while(pos < end) {
+                char32_t codepoint = 0;
+                pos += decode_valid_utf8_sequence(str + pos, codepoint);
+                written += store_codepoint(codepoint, out + written);
+            }
+
+            return pos;
+        }
+    }
+
+    /*
+     * The vectorized decoders compute, at every byte position of a window, the code point that a 1-, 2- or 3-byte
+     * sequence starting there would have. The values found at lead bytes are then moved to the front of the register
+     * with a shuffle selected by the mask of lead bytes, which drops the ones computed at continuation bytes.
+     */
+    struct utf16_compaction_table {
+        alignas(16) std::uint8_t shuffle[256][16];
+    };
+
+    constexpr utf16_compaction_table make_utf16_compaction_table() {
+        utf16_compaction_table table{};
+        for(unsigned mask = 0; mask < 256; ++mask) {
+            unsigned kept = 0;
+            for(unsigned lane = 0; lane < 8; ++lane) {
+                if(mask & (1u << lane)) {
+                    table.shuffle[mask][2 * kept] = static_cast<std::uint8_t>(2 * lane);
+                    table.shuffle[mask][2 * kept + 1] = static_cast<std::uint8_t>(2 * lane + 1);
+                    ++kept;
+                }
+            }
+            for(; kept < 8; ++kept) {
+                table.shuffle[mask][2 * kept] = 0x80;
+                table.shuffle[mask][2 * kept + 1] = 0x80;
+            }
+        }
+
+        return table;
+    }
+
+    constexpr utf16_compaction_table utf16_compaction = make_utf16_compaction_table();
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace sse41 {
+        UNISTRING_TARGET_SSE41
+        std::size_t utf16_length_from_utf8(std::uint8_t const *str, std::size_t length, bool &ascii) {
+            __m128i const last_continuation = _mm_set1_epi8(static_cast<char>(0xBF));
+            __m128i const four_byte_lead = _mm_set1_epi8(static_cast<char>(0xF0));
+            __m128i seen = _mm_setzero_si128();
+            std::size_t pos = 0, count = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                unsigned const starts = _mm_movemask_epi8(_mm_cmpgt_epi8(input, last_continuation));
+                unsigned const pairs = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(input, four_byte_lead), input));
+                count += __builtin_popcount(starts) + __builtin_popcount(pairs);
+                seen = _mm_or_si128(seen, input);
+            }
+            count += scalar::utf16_length_from_utf8(str + pos, length - pos, ascii);
+            ascii = ascii && _mm_movemask_epi8(seen) == 0;
+
+            return count;
+        }
+
+        /**
+         * Decodes the sequences starting in the 8 bytes at str, none of which may be a 4-byte lead. Writes 8 units and
+         * returns how many of them are meaningful.
+         */
+        UNISTRING_TARGET_SSE41
+        inline std::size_t decode_utf8_window(std::uint8_t const *str, char16_t *out) {
+            __m128i const byte_0 = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(str)));
+            __m128i const byte_1 = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(str + 1)));
+            __m128i const byte_2 = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(str + 2)));
+
+            __m128i const payload = _mm_set1_epi16(0x3F);
+            __m128i const payload_1 = _mm_and_si128(byte_1, payload);
+            __m128i const two_bytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(byte_0, _mm_set1_epi16(0x1F)), 6), payload_1);
+            __m128i const three_bytes = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(byte_0, 12), _mm_slli_epi16(payload_1, 6)),
+                                                     _mm_and_si128(byte_2, payload));
+
+            __m128i codepoints = _mm_blendv_epi8(byte_0, two_bytes, _mm_cmpgt_epi16(byte_0, _mm_set1_epi16(0x7F)));
+            codepoints = _mm_blendv_epi8(codepoints, three_bytes, _mm_cmpgt_epi16(byte_0, _mm_set1_epi16(0xDF)));
+
+            __m128i const continuation = _mm_cmpeq_epi16(_mm_and_si128(byte_0, _mm_set1_epi16(0xC0)), _mm_set1_epi16(0x80));
+            unsigned const leads = ~_mm_movemask_epi8(_mm_packs_epi16(continuation, _mm_setzero_si128())) & 0xFF;
+            __m128i const shuffle = _mm_load_si128(reinterpret_cast<__m128i const *>(utf16_compaction.shuffle[leads]));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_shuffle_epi8(codepoints, shuffle));
+
+            return __builtin_popcount(leads);
+        }
+
+        /**
+         * Converts the 4 sequences of 4 bytes held by input, which must be valid, to the 8 units of their surrogate
+         * pairs.
+         */
+        UNISTRING_TARGET_SSE41
+        inline void decode_utf8_four_byte_window(__m128i input, char16_t *out) {
+            __m128i const words = _mm_shuffle_epi8(input, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+            __m128i const payload = _mm_set1_epi32(0x3F);
+            __m128i codepoints = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(words, 6), _mm_set1_epi32(0x1C0000)),
+                                              _mm_and_si128(_mm_srli_epi32(words, 4), _mm_set1_epi32(0x3F000)));
+            codepoints = _mm_or_si128(codepoints, _mm_and_si128(_mm_srli_epi32(words, 2), _mm_set1_epi32(0xFC0)));
+            codepoints = _mm_sub_epi32(_mm_or_si128(codepoints, _mm_and_si128(words, payload)), _mm_set1_epi32(0x10000));
+            __m128i const high = _mm_or_si128(_mm_srli_epi32(codepoints, 10), _mm_set1_epi32(0xD800));
+            __m128i const low = _mm_or_si128(_mm_and_si128(codepoints, _mm_set1_epi32(0x3FF)), _mm_set1_epi32(0xDC00));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_or_si128(high, _mm_slli_epi32(low, 16)));
+        }
+
+        UNISTRING_TARGET_SSE41
+        conversion_result convert_utf8_to_utf16(std::uint8_t const *str, std::size_t length, char16_t *out) {
+            if(!validate_utf8(str, length)) {
+                return scalar::convert_utf8_to_utf16(str, length, out);
+            }
+
+            __m128i const four_byte_lead = _mm_set1_epi8(static_cast<char>(0xF0));
+            std::size_t pos = 0, written = 0;
+            while(pos + 16 <= length) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                if(_mm_movemask_epi8(input) == 0) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), _mm_cvtepu8_epi16(input));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written + 8),
+                                     _mm_cvtepu8_epi16(_mm_srli_si128(input, 8)));
+                    pos += 16;
+                    written += 16;
+                    continue;
+                }
+
+                // Windows start at a lead byte, so a 4-byte lead every 4 bytes means 4 whole surrogate pairs.
+                unsigned const four_byte_leads = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(input, four_byte_lead), input));
+                if((four_byte_leads & 0x1111) == 0x1111) {
+                    decode_utf8_four_byte_window(input, out + written);
+                    pos += 16;
+                    written += 8;
+                    continue;
+                }
+
+                // The window writes 8 units whatever it decodes: 32 bytes of valid UTF-8 ahead guarantee the room.
+                bool const has_four_bytes = (four_byte_leads & 0xFF) != 0;
+                if(pos + 32 <= length && !has_four_bytes) {
+                    written += decode_utf8_window(str + pos, out + written);
+                    pos += 8;
+                } else {
+                    pos = scalar::decode_valid_utf8(str, pos, pos + 8, out, written);
+                }
+            }
+            scalar::decode_valid_utf8(str, pos, length, out, written);
+
+            return {length, written};
+        }
+    }
+#endif
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace avx2 {
+        UNISTRING_TARGET_AVX2
+        std::size_t utf16_length_from_utf8(std::uint8_t const *str, std::size_t length, bool &ascii) {
+            __m256i const last_continuation = _mm256_set1_epi8(static_cast<char>(0xBF));
+            __m256i const four_byte_lead = _mm256_set1_epi8(static_cast<char>(0xF0));
+            __m256i seen = _mm256_setzero_si256();
+            std::size_t pos = 0, count = 0;
+            for(; pos + 32 <= length; pos += 32) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                unsigned const starts = _mm256_movemask_epi8(_mm256_cmpgt_epi8(input, last_continuation));
+                unsigned const pairs =
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(input, four_byte_lead), input));
+                count += __builtin_popcount(starts) + __builtin_popcount(pairs);
+                seen = _mm256_or_si256(seen, input);
+            }
+            count += scalar::utf16_length_from_utf8(str + pos, length - pos, ascii);
+            ascii = ascii && _mm256_movemask_epi8(seen) == 0;
+
+            return count;
+        }
+
+        /**
+         * Decodes the sequences starting in the 16 bytes at str, none of which may be a 4-byte lead. Writes up to 16
+         * units and returns how many of them are meaningful.
+         */
+        UNISTRING_TARGET_AVX2
+        inline std::size_t decode_utf8_window(std::uint8_t const *str, char16_t *out) {
+            __m256i const byte_0 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(str)));
+            __m256i const byte_1 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(str + 1)));
+            __m256i const byte_2 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(str + 2)));
+
+            __m256i const payload = _mm256_set1_epi16(0x3F);
+            __m256i const payload_1 = _mm256_and_si256(byte_1, payload);
+            __m256i const two_bytes =
+                _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(byte_0, _mm256_set1_epi16(0x1F)), 6), payload_1);
+            __m256i const three_bytes =
+                _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(byte_0, 12), _mm256_slli_epi16(payload_1, 6)),
+                                _mm256_and_si256(byte_2, payload));
+
+            __m256i codepoints = _mm256_blendv_epi8(byte_0, two_bytes, _mm256_cmpgt_epi16(byte_0, _mm256_set1_epi16(0x7F)));
+            codepoints = _mm256_blendv_epi8(codepoints, three_bytes, _mm256_cmpgt_epi16(byte_0, _mm256_set1_epi16(0xDF)));
+
+            // Packing works within 128-bit lanes: the lead bits of each half land in bits 0-7 and 16-23.
+            __m256i const continuation =
+                _mm256_cmpeq_epi16(_mm256_and_si256(byte_0, _mm256_set1_epi16(0xC0)), _mm256_set1_epi16(0x80));
+            unsigned const not_leads = _mm256_movemask_epi8(_mm256_packs_epi16(continuation, _mm256_setzero_si256()));
+            unsigned const low_leads = ~not_leads & 0xFF;
+            unsigned const high_leads = ~(not_leads >> 16) & 0xFF;
+            __m256i const shuffle = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_load_si128(reinterpret_cast<__m128i const *>(utf16_compaction.shuffle[low_leads]))),
+                _mm_load_si128(reinterpret_cast<__m128i const *>(utf16_compaction.shuffle[high_leads])), 1);
+            __m256i const compacted = _mm256_shuffle_epi8(codepoints, shuffle);
+
+            std::size_t const low_count = __builtin_popcount(low_leads);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm256_castsi256_si128(compacted));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + low_count), _mm256_extracti128_si256(compacted, 1));
+
+            return low_count + __builtin_popcount(high_leads);
+        }
+
+        /**
+         * Converts the 8 sequences of 4 bytes held by input, which must be valid, to the 16 units of their surrogate
+         * pairs.
+         */
+        UNISTRING_TARGET_AVX2
+        inline void decode_utf8_four_byte_window(__m256i input, char16_t *out) {
+            __m256i const words = _mm256_shuffle_epi8(input, _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                                                              3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+            __m256i const payload = _mm256_set1_epi32(0x3F);
+            __m256i codepoints = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(words, 6), _mm256_set1_epi32(0x1C0000)),
+                                                 _mm256_and_si256(_mm256_srli_epi32(words, 4), _mm256_set1_epi32(0x3F000)));
+            codepoints = _mm256_or_si256(codepoints, _mm256_and_si256(_mm256_srli_epi32(words, 2), _mm256_set1_epi32(0xFC0)));
+            codepoints =
+                _mm256_sub_epi32(_mm256_or_si256(codepoints, _mm256_and_si256(words, payload)), _mm256_set1_epi32(0x10000));
+            __m256i const high = _mm256_or_si256(_mm256_srli_epi32(codepoints, 10), _mm256_set1_epi32(0xD800));
+            __m256i const low =
+                _mm256_or_si256(_mm256_and_si256(codepoints, _mm256_set1_epi32(0x3FF)), _mm256_set1_epi32(0xDC00));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), _mm256_or_si256(high, _mm256_slli_epi32(low, 16)));
+        }
+
+        UNISTRING_TARGET_AVX2
+        conversion_result convert_utf8_to_utf16(std::uint8_t const *str, std::size_t length, char16_t *out) {
+            if(!validate_utf8(str, length)) {
+                return scalar::convert_utf8_to_utf16(str, length, out);
+            }
+
+            __m256i const four_byte_lead = _mm256_set1_epi8(static_cast<char>(0xF0));
+            std::size_t pos = 0, written = 0;
+            while(pos + 32 <= length) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                if(_mm256_movemask_epi8(input) == 0) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written),
+                                        _mm256_cvtepu8_epi16(_mm256_castsi256_si128(input)));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written + 16),
+                                        _mm256_cvtepu8_epi16(_mm256_extracti128_si256(input, 1)));
+                    pos += 32;
+                    written += 32;
+                    continue;
+                }
+
+                // Windows start at a lead byte, so a 4-byte lead every 4 bytes means 8 whole surrogate pairs.
+                unsigned const four_byte_leads =
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(input, four_byte_lead), input));
+                if((four_byte_leads & 0x11111111) == 0x11111111) {
+                    decode_utf8_four_byte_window(input, out + written);
+                    pos += 32;
+                    written += 16;
+                    continue;
+                }
+
+                // The window writes up to 16 units whatever it decodes: 64 bytes of valid UTF-8 ahead guarantee the room.
+                bool const has_four_bytes = (four_byte_leads & 0xFFFF) != 0;
+                if(pos + 64 <= length && !has_four_bytes) {
+                    written += decode_utf8_window(str + pos, out + written);
+                    pos += 16;
+                } else {
+                    pos = scalar::decode_valid_utf8(str, pos, pos + 16, out, written);
+                }
+            }
+            scalar::decode_valid_utf8(str, pos, length, out, written);
+
+            return {length, written};
+        }
+    }
+#endif
+}
+
+// UTF-16 and UTF-32 to UTF-8
+
+namespace {
+    namespace scalar {
+        inline std::size_t encode_utf8(char32_t codepoint, std::uint8_t *out) {
+            if(codepoint < 0x80) {
+                out[0] = static_cast<std::uint8_t>(codepoint);
+                return 1;
+            } else if(codepoint < 0x800) {
+                out[0] = static_cast<std::uint8_t>(0xC0 | (codepoint >> 6));
+                out[1] = static_cast<std::uint8_t>(0x80 | (codepoint & 0x3F));
+                return 2;
+            } else if(codepoint < 0x10000) {
+                out[0] = static_cast<std::uint8_t>(0xE0 | (codepoint >> 12));
+                out[1] = static_cast<std::uint8_t>(0x80 | ((codepoint >> 6) & 0x3F));
+                out[2] = static_cast<std::uint8_t>(0x80 | (codepoint & 0x3F));
+                return 3;
+            }
+            out[0] = static_cast<std::uint8_t>(0xF0 | (codepoint >> 18));
+            out[1] = static_cast<std::uint8_t>(0x80 | ((codepoint >> 12) & 0x3F));
+            out[2] = static_cast<std::uint8_t>(0x80 | ((codepoint >> 6) & 0x3F));
+            out[3] = static_cast<std::uint8_t>(0x80 | (codepoint & 0x3F));
+            return 4;
+        }
+
+        inline bool is_ascii_units(char16_t const *str) {
+            std::uint64_t units;
+            std::memcpy(&units, str, sizeof(units));
+            return (units & 0xFF80FF80FF80FF80ULL) == 0;
+        }
+
+        std::size_t utf8_length_from_utf16(char16_t const *str, std::size_t length) {
+            std::size_t count = 0;
+            for(std::size_t pos = 0; pos < length; ++pos) {
+                char16_t const unit = str[pos];
+                count += 1 + (unit >= 0x80) + (unit >= 0x800) - ((unit & 0xF800) == 0xD800);
+            }
+
+            return count;
+        }
+
+        /**
+         * Encodes the code points of str starting before str + end, the last one possibly ending after it. Returns
+         * the position reached, which is less than end if an unpaired surrogate was found.
+         */
+        inline std::size_t encode_utf16_as_utf8(
+            char16_t const *str, std::size_t pos, std::size_t end, std::size_t length, std::uint8_t *out, std::size_t &written) {
+            while(pos < end) {
+                char32_t codepoint = 0;
+                std::size_t consumed = decode_utf16(str + pos, length - pos, codepoint);
+                if(consumed == 0) {
+                    break;
+                }
+                pos += consumed;
+                written += encode_utf8(codepoint, out + written);
+            }
+
+            return pos;
+        }
+
+        std::size_t utf8_length_from_utf32(char32_t const *str, std::size_t length) {
+            std::size_t count = length;
+            for(std::size_t pos = 0; pos < length; ++pos) {
+                count += (str[pos] >= 0x80) + (str[pos] >= 0x800) + (str[pos] >= 0x10000);
+            }
+
+            return count;
+        }
+
+        conversion_result convert_utf32_to_utf8(char32_t const *str, std::size_t length, std::uint8_t *out) {
+            std::size_t pos = 0, written = 0;
+            for(; pos < length; ++pos) {
+                char32_t const codepoint = str[pos];
+                if(codepoint >= 0x110000 || (codepoint & 0xFFFFF800) == 0xD800) {
+                    break;
+                }
+                written += encode_utf8(codepoint, out + written);
+            }
+
+            return {pos, written};
+        }
+
+        conversion_result convert_utf16_to_utf8(char16_t const *str, std::size_t length, std::uint8_t *out) {
+            std::size_t pos = 0, written = 0;
+            while(pos < length) {
+                if(pos + 4 <= length && is_ascii_units(str + pos)) {
+                    for(std::size_t i = 0; i < 4; ++i) {
+                        out[written++] = static_cast<std::uint8_t>(str[pos++]);
+                    }
+                    continue;
+                }
+                std::size_t const next = encode_utf16_as_utf8(str, pos, pos + 1, length, out, written);
+                if(next == pos) {
+                    break;
+                }
+                pos = next;
+            }
+
+            return {pos, written};
+        }
+    }
+
+    /*
+     * Table of shuffles moving the bytes selected by an 8-bit mask to the front of the low 8 bytes of a register.
+     */
+    struct byte_compaction_table {
+        std::uint8_t shuffle[256][8];
+    };
+
+    constexpr byte_compaction_table make_byte_compaction_table() {
+        byte_compaction_table table{};
+        for(unsigned mask = 0; mask < 256; ++mask) {
+            unsigned kept = 0;
+            for(unsigned byte = 0; byte < 8; ++byte) {
+                if(mask & (1u << byte)) {
+                    table.shuffle[mask][kept++] = static_cast<std::uint8_t>(byte);
+                }
+            }
+            for(; kept < 8; ++kept) {
+                table.shuffle[mask][kept] = 0x80;
+            }
+        }
+
+        return table;
+    }
+
+    constexpr byte_compaction_table byte_compaction = make_byte_compaction_table();
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace sse_blocks {
+        // Second and third bytes of the 3-byte sequences of 8 code points, laid out as leads, seconds, thirds.
+        alignas(16) constexpr std::uint8_t three_bytes_first_16[2][16] = {
+            {0, 8, 0x80, 1, 9, 0x80, 2, 10, 0x80, 3, 11, 0x80, 4, 12, 0x80, 5},
+            {0x80, 0x80, 0, 0x80, 0x80, 1, 0x80, 0x80, 2, 0x80, 0x80, 3, 0x80, 0x80, 4, 0x80},
+        };
+        alignas(16) constexpr std::uint8_t three_bytes_last_8[2][16] = {
+            {13, 0x80, 6, 14, 0x80, 7, 15, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+            {0x80, 5, 0x80, 0x80, 6, 0x80, 0x80, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        };
+
+        /**
+         * Encodes 8 BMP code points to UTF-8 if they are all 1- and 2-byte sequences, or all 3-byte ones, advancing
+         * written. Up to 4 bytes past the encoded ones may be overwritten. Returns false, writing nothing, for the
+         * other blocks, which include those holding surrogates.
+         */
+        UNISTRING_TARGET_SSE41 UNISTRING_ALWAYS_INLINE
+        inline bool encode_bmp_utf8(__m128i input, std::uint8_t *out, std::size_t &written) {
+            __m128i const high_bits = _mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xF800)));
+
+            if(_mm_testz_si128(input, _mm_set1_epi16(static_cast<short>(0xFF80)))) {
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(out + written), _mm_packus_epi16(input, input));
+                written += 8;
+                return true;
+            }
+
+            if(_mm_testz_si128(high_bits, high_bits)) {
+                // Each 16-bit lane holds the sequence of its unit, first byte low; the second one is dropped for ASCII.
+                __m128i const ascii = _mm_cmpeq_epi16(_mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xFF80))),
+                                                      _mm_setzero_si128());
+                __m128i const lead = _mm_or_si128(_mm_srli_epi16(input, 6), _mm_set1_epi16(0xC0));
+                __m128i const continuation = _mm_or_si128(_mm_and_si128(input, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+                __m128i const sequences = _mm_blendv_epi8(_mm_or_si128(lead, _mm_slli_epi16(continuation, 8)), input, ascii);
+
+                unsigned const kept = 0x5555 | (~_mm_movemask_epi8(ascii) & 0xAAAA);
+                unsigned const low_kept = kept & 0xFF, high_kept = kept >> 8;
+                __m128i const low_shuffle = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(byte_compaction.shuffle[low_kept]));
+                __m128i const high_shuffle = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(byte_compaction.shuffle[high_kept]));
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(out + written), _mm_shuffle_epi8(sequences, low_shuffle));
+                written += __builtin_popcount(low_kept);
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(out + written),
+                                 _mm_shuffle_epi8(_mm_srli_si128(sequences, 8), high_shuffle));
+                written += __builtin_popcount(high_kept);
+                return true;
+            }
+
+            unsigned const below_800 = _mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, _mm_setzero_si128()));
+            unsigned const surrogates = _mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, _mm_set1_epi16(static_cast<short>(0xD800))));
+            if((below_800 | surrogates) == 0) {
+                __m128i const lead = _mm_or_si128(_mm_srli_epi16(input, 12), _mm_set1_epi16(0xE0));
+                __m128i const second = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(input, 6), _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+                __m128i const third = _mm_or_si128(_mm_and_si128(input, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+                __m128i const leads_seconds = _mm_packus_epi16(lead, second);
+                __m128i const thirds = _mm_packus_epi16(third, third);
+
+                __m128i const first_16 = _mm_or_si128(
+                    _mm_shuffle_epi8(leads_seconds, _mm_load_si128(reinterpret_cast<__m128i const *>(three_bytes_first_16[0]))),
+                    _mm_shuffle_epi8(thirds, _mm_load_si128(reinterpret_cast<__m128i const *>(three_bytes_first_16[1]))));
+                __m128i const last_8 = _mm_or_si128(
+                    _mm_shuffle_epi8(leads_seconds, _mm_load_si128(reinterpret_cast<__m128i const *>(three_bytes_last_8[0]))),
+                    _mm_shuffle_epi8(thirds, _mm_load_si128(reinterpret_cast<__m128i const *>(three_bytes_last_8[1]))));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), first_16);
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(out + written + 16), last_8);
+                written += 24;
+                return true;
+            }
+
+            return false;
+        }
+
+        /**
+         * Encodes the 8 units at str + pos to UTF-8, advancing pos and written, with the scalar encoder for the blocks
+         * encode_bmp_utf8 rejects. Returns false on an unpaired surrogate.
+         */
+        UNISTRING_TARGET_SSE41 UNISTRING_ALWAYS_INLINE
+        inline bool
+            encode_utf8_block(char16_t const *str, std::size_t &pos, std::size_t length, std::uint8_t *out, std::size_t &written) {
+            if(encode_bmp_utf8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos)), out, written)) {
+                pos += 8;
+                return true;
+            }
+
+            std::size_t const end = pos + 8;
+            pos = scalar::encode_utf16_as_utf8(str, pos, end, length, out, written);
+            return pos >= end;
+        }
+
+        /**
+         * Encodes the 8 code points at str + pos to UTF-8, advancing pos and written, with the scalar encoder for the
+         * blocks holding supplementary code points or rejected by encode_bmp_utf8. Returns false on an invalid one.
+         */
+        UNISTRING_TARGET_SSE41 UNISTRING_ALWAYS_INLINE
+        inline bool
+            encode_utf8_block(char32_t const *str, std::size_t &pos, std::uint8_t *out, std::size_t &written) {
+            __m128i const low = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+            __m128i const high = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos + 4));
+            if(_mm_testz_si128(_mm_or_si128(low, high), _mm_set1_epi32(static_cast<int>(0xFFFF0000))) &&
+               encode_bmp_utf8(_mm_packus_epi32(low, high), out, written)) {
+                pos += 8;
+                return true;
+            }
+
+            auto block = scalar::convert_utf32_to_utf8(str + pos, 8, out + written);
+            pos += block.read;
+            written += block.written;
+            return block.read == 8;
+        }
+
+        UNISTRING_TARGET_SSE41 UNISTRING_ALWAYS_INLINE
+        inline std::size_t utf8_length_from_utf16_block(__m128i input) {
+            __m128i const zero = _mm_setzero_si128();
+            unsigned const ascii = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xFF80))), zero));
+            __m128i const high_bits = _mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xF800)));
+            unsigned const below_800 = _mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, zero));
+            unsigned const surrogates = _mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, _mm_set1_epi16(static_cast<short>(0xD800))));
+
+            // Every unit counts 3 bytes, minus one for each threshold it is below; a surrogate counts 2.
+            return 24 - (__builtin_popcount(ascii) + __builtin_popcount(below_800) + __builtin_popcount(surrogates)) / 2;
+        }
+
+        /**
+         * Returns the number of bytes beyond the first one that the 4 code points of input take in UTF-8.
+         */
+        UNISTRING_TARGET_SSE41 UNISTRING_ALWAYS_INLINE
+        inline std::size_t utf8_extra_length_from_utf32_block(__m128i input) {
+            __m128i const above_7f = _mm_cmpeq_epi32(_mm_max_epu32(input, _mm_set1_epi32(0x80)), input);
+            __m128i const above_7ff = _mm_cmpeq_epi32(_mm_max_epu32(input, _mm_set1_epi32(0x800)), input);
+            __m128i const above_ffff = _mm_cmpeq_epi32(_mm_max_epu32(input, _mm_set1_epi32(0x10000)), input);
+
+            return __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(above_7f))) +
+                   __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(above_7ff))) +
+                   __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(above_ffff)));
+        }
+    }
+#endif
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace sse41 {
+        UNISTRING_TARGET_SSE41
+        std::size_t utf8_length_from_utf16(char16_t const *str, std::size_t length) {
+            std::size_t pos = 0, count = 0;
+            for(; pos + 8 <= length; pos += 8) {
+                count += sse_blocks::utf8_length_from_utf16_block(_mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos)));
+            }
+
+            return count + scalar::utf8_length_from_utf16(str + pos, length - pos);
+        }
+
+        UNISTRING_TARGET_SSE41
+        conversion_result convert_utf16_to_utf8(char16_t const *str, std::size_t length, std::uint8_t *out) {
+            // 8 units ahead of the block leave room for the bytes it may overwrite.
+            std::size_t pos = 0, written = 0;
+            while(pos + 16 <= length) {
+                if(!sse_blocks::encode_utf8_block(str, pos, length, out, written)) {
+                    return {pos, written};
+                }
+            }
+            pos = scalar::encode_utf16_as_utf8(str, pos, length, length, out, written);
+
+            return {pos, written};
+        }
+
+        UNISTRING_TARGET_SSE41
+        std::size_t utf8_length_from_utf32(char32_t const *str, std::size_t length) {
+            std::size_t pos = 0, count = length;
+            for(; pos + 4 <= length; pos += 4) {
+                count += sse_blocks::utf8_extra_length_from_utf32_block(_mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos)));
+            }
+
+            return count + scalar::utf8_length_from_utf32(str + pos, length - pos) - (length - pos);
+        }
+
+        UNISTRING_TARGET_SSE41
+        conversion_result convert_utf32_to_utf8(char32_t const *str, std::size_t length, std::uint8_t *out) {
+            // 8 code points ahead of the block leave room for the bytes it may overwrite.
+            std::size_t pos = 0, written = 0;
+            while(pos + 16 <= length) {
+                if(!sse_blocks::encode_utf8_block(str, pos, out, written)) {
+                    return {pos, written};
+                }
+            }
+            auto tail = scalar::convert_utf32_to_utf8(str + pos, length - pos, out + written);
+
+            return {pos + tail.read, written + tail.written};
+        }
+    }
+#endif
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace avx2 {
+        UNISTRING_TARGET_AVX2
+        std::size_t utf8_length_from_utf16(char16_t const *str, std::size_t length) {
+            std::size_t pos = 0, count = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                count += sse_blocks::utf8_length_from_utf16_block(_mm256_castsi256_si128(input)) +
+                         sse_blocks::utf8_length_from_utf16_block(_mm256_extracti128_si256(input, 1));
+            }
+
+            return count + scalar::utf8_length_from_utf16(str + pos, length - pos);
+        }
+
+        UNISTRING_TARGET_AVX2
+        conversion_result convert_utf16_to_utf8(char16_t const *str, std::size_t length, std::uint8_t *out) {
+            std::size_t pos = 0, written = 0;
+            while(pos + 32 <= length) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                if(_mm256_testz_si256(input, _mm256_set1_epi16(static_cast<short>(0xFF80)))) {
+                    __m128i const packed = _mm_packus_epi16(_mm256_castsi256_si128(input), _mm256_extracti128_si256(input, 1));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), packed);
+                    pos += 16;
+                    written += 16;
+                    continue;
+                }
+                if(!sse_blocks::encode_utf8_block(str, pos, length, out, written)) {
+                    return {pos, written};
+                }
+            }
+            while(pos + 16 <= length) {
+                if(!sse_blocks::encode_utf8_block(str, pos, length, out, written)) {
+                    return {pos, written};
+                }
+            }
+            pos = scalar::encode_utf16_as_utf8(str, pos, length, length, out, written);
+
+            return {pos, written};
+        }
+
+        UNISTRING_TARGET_AVX2
+        std::size_t utf8_length_from_utf32(char32_t const *str, std::size_t length) {
+            std::size_t pos = 0, count = length;
+            for(; pos + 8 <= length; pos += 8) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                count += sse_blocks::utf8_extra_length_from_utf32_block(_mm256_castsi256_si128(input)) +
+                         sse_blocks::utf8_extra_length_from_utf32_block(_mm256_extracti128_si256(input, 1));
+            }
+
+            return count + scalar::utf8_length_from_utf32(str + pos, length - pos) - (length - pos);
+        }
+
+        UNISTRING_TARGET_AVX2
+        conversion_result convert_utf32_to_utf8(char32_t const *str, std::size_t length, std::uint8_t *out) {
+            std::size_t pos = 0, written = 0;
+            while(pos + 32 <= length) {
+                __m256i const low = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                __m256i const high = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos + 8));
+                if(_mm256_testz_si256(_mm256_or_si256(low, high), _mm256_set1_epi32(static_cast<int>(0xFFFFFF80)))) {
+                    __m256i const units = _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), 0xD8);
+                    __m128i const packed = _mm_packus_epi16(_mm256_castsi256_si128(units), _mm256_extracti128_si256(units, 1));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), packed);
+                    pos += 16;
+                    written += 16;
+                    continue;
+                }
+                if(!sse_blocks::encode_utf8_block(str, pos, out, written)) {
+                    return {pos, written};
+                }
+            }
+            while(pos + 16 <= length) {
+                if(!sse_blocks::encode_utf8_block(str, pos, out, written)) {
+                    return {pos, written};
+                }
+            }
+            auto tail = scalar::convert_utf32_to_utf8(str + pos, length - pos, out + written);
+
+            return {pos + tail.read, written + tail.written};
+        }
+    }
+#endif
+}
+
+// UTF-8 to UTF-32
+
+namespace {
+    namespace scalar {
+        std::size_t utf32_length_from_utf8(std::uint8_t const *str, std::size_t length, bool &ascii) {
+            std::size_t count = 0;
+            std::uint8_t seen = 0;
+            for(std::size_t pos = 0; pos < length; ++pos) {
+                count += (str[pos] & 0xC0) != 0x80;
+                seen |= str[pos];
+            }
+            ascii = seen < 0x80;
+
+            return count;
+        }
+
+        conversion_result convert_utf8_to_utf32(std::uint8_t const *str, std::size_t length, char32_t *out) {
+            std::size_t pos = 0, written = 0;
+            while(pos < length) {
+                if(pos + 8 <= length && is_ascii_word(str + pos)) {
+                    for(std::size_t end = pos + 8; pos < end; ++pos) {
+                        out[written++] = str[pos];
+                    }
+                    continue;
+                }
+                char32_t codepoint;
+                std::size_t consumed = decode_utf8(str + pos, length - pos, codepoint);
+                if(consumed == 0) {
+                    break;
+                }
+                pos += consumed;
+                out[written++] = codepoint;
+            }
+
+            return {pos, written};
+        }
+    }
+
+    /*
+     * The vectorized decoders reuse the UTF-16 windows, whose units are code points since they hold no 4-byte
+     * sequence, and widen them.
+     */
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace sse41 {
+        UNISTRING_TARGET_SSE41
+        std::size_t utf32_length_from_utf8(std::uint8_t const *str, std::size_t length, bool &ascii) {
+            __m128i const last_continuation = _mm_set1_epi8(static_cast<char>(0xBF));
+            __m128i seen = _mm_setzero_si128();
+            std::size_t pos = 0, count = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(input, last_continuation)));
+                seen = _mm_or_si128(seen, input);
+            }
+            count += scalar::utf32_length_from_utf8(str + pos, length - pos, ascii);
+            ascii = ascii && _mm_movemask_epi8(seen) == 0;
+
+            return count;
+        }
+
+        UNISTRING_TARGET_SSE41
+        conversion_result convert_utf8_to_utf32(std::uint8_t const *str, std::size_t length, char32_t *out) {
+            if(!validate_utf8(str, length)) {
+                return scalar::convert_utf8_to_utf32(str, length, out);
+            }
+
+            __m128i const four_byte_lead = _mm_set1_epi8(static_cast<char>(0xF0));
+            std::size_t pos = 0, written = 0;
+            while(pos + 16 <= length) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                if(_mm_movemask_epi8(input) == 0) {
+                    __m128i bytes = input;
+                    for(int quarter = 0; quarter < 4; ++quarter) {
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written + 4 * quarter), _mm_cvtepu8_epi32(bytes));
+                        bytes = _mm_srli_si128(bytes, 4);
+                    }
+                    pos += 16;
+                    written += 16;
+                    continue;
+                }
+
+                // The window writes 8 code points whatever it decodes: 32 bytes of valid UTF-8 ahead guarantee the room.
+                bool const has_four_bytes =
+                    (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(input, four_byte_lead), input)) & 0xFF) != 0;
+                if(pos + 32 <= length && !has_four_bytes) {
+                    alignas(16) char16_t units[8];
+                    std::size_t const count = decode_utf8_window(str + pos, units);
+                    __m128i const decoded = _mm_load_si128(reinterpret_cast<__m128i const *>(units));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), _mm_cvtepu16_epi32(decoded));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written + 4), _mm_cvtepu16_epi32(_mm_srli_si128(decoded, 8)));
+                    written += count;
+                    pos += 8;
+                } else {
+                    pos = scalar::decode_valid_utf8(str, pos, pos + 8, out, written);
+                }
+            }
+            scalar::decode_valid_utf8(str, pos, length, out, written);
+
+            return {length, written};
+        }
+    }
+#endif
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace avx2 {
+        UNISTRING_TARGET_AVX2
+        std::size_t utf32_length_from_utf8(std::uint8_t const *str, std::size_t length, bool &ascii) {
+            __m256i const last_continuation = _mm256_set1_epi8(static_cast<char>(0xBF));
+            __m256i seen = _mm256_setzero_si256();
+            std::size_t pos = 0, count = 0;
+            for(; pos + 32 <= length; pos += 32) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                count += __builtin_popcount(_mm256_movemask_epi8(_mm256_cmpgt_epi8(input, last_continuation)));
+                seen = _mm256_or_si256(seen, input);
+            }
+            count += scalar::utf32_length_from_utf8(str + pos, length - pos, ascii);
+            ascii = ascii && _mm256_movemask_epi8(seen) == 0;
+
+            return count;
+        }
+
+        UNISTRING_TARGET_AVX2
+        conversion_result convert_utf8_to_utf32(std::uint8_t const *str, std::size_t length, char32_t *out) {
+            if(!validate_utf8(str, length)) {
+                return scalar::convert_utf8_to_utf32(str, length, out);
+            }
+
+            __m256i const four_byte_lead = _mm256_set1_epi8(static_cast<char>(0xF0));
+            std::size_t pos = 0, written = 0;
+            while(pos + 32 <= length) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                if(_mm256_movemask_epi8(input) == 0) {
+                    for(int quarter = 0; quarter < 4; ++quarter) {
+                        __m128i const bytes = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(str + pos + 8 * quarter));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written + 8 * quarter), _mm256_cvtepu8_epi32(bytes));
+                    }
+                    pos += 32;
+                    written += 32;
+                    continue;
+                }
+
+                // The window writes 16 code points whatever it decodes: 64 bytes of valid UTF-8 ahead guarantee the room.
+                bool const has_four_bytes =
+                    (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(input, four_byte_lead), input)) & 0xFFFF) != 0;
+                if(pos + 64 <= length && !has_four_bytes) {
+                    alignas(32) char16_t units[16];
+                    std::size_t const count = decode_utf8_window(str + pos, units);
+                    __m256i const decoded = _mm256_load_si256(reinterpret_cast<__m256i const *>(units));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written), _mm256_cvtepu16_epi32(_mm256_castsi256_si128(decoded)));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written + 8),
+                                        _mm256_cvtepu16_epi32(_mm256_extracti128_si256(decoded, 1)));
+                    written += count;
+                    pos += 16;
+                } else {
+                    pos = scalar::decode_valid_utf8(str, pos, pos + 16, out, written);
+                }
+            }
+            scalar::decode_valid_utf8(str, pos, length, out, written);
+
+            return {length, written};
+        }
+    }
+#endif
+}
+
+// ASCII
+
+namespace {
+    namespace scalar {
+        bool is_ascii_utf8(std::uint8_t const *str, std::size_t length) {
+            std::size_t pos = 0;
+            for(; pos + 8 <= length; pos += 8) {
+                if(!is_ascii_word(str + pos)) {
+                    return false;
+                }
+            }
+
+            return std::all_of(str + pos, str + length, [](std::uint8_t byte) { return byte < 0x80; });
+        }
+
+        bool is_ascii_utf16(char16_t const *str, std::size_t length) {
+            std::size_t pos = 0;
+            for(; pos + 4 <= length; pos += 4) {
+                if(!is_ascii_units(str + pos)) {
+                    return false;
+                }
+            }
+
+            return std::all_of(str + pos, str + length, [](char16_t unit) { return unit < 0x80; });
+        }
+
+        bool is_ascii_utf32(char32_t const *str, std::size_t length) {
+            return std::all_of(str, str + length, [](char32_t unit) { return unit < 0x80; });
+        }
+    }
+
+    /*
+     * The vectorized checks OR 4 registers together before testing them, and return as soon as a block holds a
+     * non-ASCII unit.
+     */
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace sse41 {
+        UNISTRING_TARGET_SSE41
+        inline bool is_ascii_blocks(std::uint8_t const *str, std::size_t length, __m128i non_ascii, std::size_t &pos) {
+            for(; pos + 64 <= length; pos += 64) {
+                __m128i const block =
+                    _mm_or_si128(_mm_or_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos)),
+                                              _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos + 16))),
+                                 _mm_or_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos + 32)),
+                                              _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos + 48))));
+                if(!_mm_testz_si128(block, non_ascii)) {
+                    return false;
+                }
+            }
+            for(; pos + 16 <= length; pos += 16) {
+                if(!_mm_testz_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos)), non_ascii)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        UNISTRING_TARGET_SSE41
+        bool is_ascii_utf8(std::uint8_t const *str, std::size_t length) {
+            std::size_t pos = 0;
+            return is_ascii_blocks(str, length, _mm_set1_epi8(static_cast<char>(0x80)), pos) &&
+                   scalar::is_ascii_utf8(str + pos, length - pos);
+        }
+
+        UNISTRING_TARGET_SSE41
+        bool is_ascii_utf16(char16_t const *str, std::size_t length) {
+            std::size_t pos = 0;
+            return is_ascii_blocks(reinterpret_cast<std::uint8_t const *>(str), 2 * length,
+                                   _mm_set1_epi16(static_cast<short>(0xFF80)), pos) &&
+                   scalar::is_ascii_utf16(str + pos / 2, length - pos / 2);
+        }
+
+        UNISTRING_TARGET_SSE41
+        bool is_ascii_utf32(char32_t const *str, std::size_t length) {
+            std::size_t pos = 0;
+            return is_ascii_blocks(reinterpret_cast<std::uint8_t const *>(str), 4 * length,
+                                   _mm_set1_epi32(static_cast<int>(0xFFFFFF80)), pos) &&
+                   scalar::is_ascii_utf32(str + pos / 4, length - pos / 4);
+        }
+    }
+
+    namespace avx2 {
+        UNISTRING_TARGET_AVX2
+        inline bool is_ascii_blocks(std::uint8_t const *str, std::size_t length, __m256i non_ascii, std::size_t &pos) {
+            for(; pos + 128 <= length; pos += 128) {
+                __m256i const block =
+                    _mm256_or_si256(_mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos)),
+                                                    _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos + 32))),
+                                    _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos + 64)),
+                                                    _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos + 96))));
+                if(!_mm256_testz_si256(block, non_ascii)) {
+                    return false;
+                }
+            }
+            for(; pos + 32 <= length; pos += 32) {
+                if(!_mm256_testz_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos)), non_ascii)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        UNISTRING_TARGET_AVX2
+        bool is_ascii_utf8(std::uint8_t const *str, std::size_t length) {
+            std::size_t pos = 0;
+            return is_ascii_blocks(str, length, _mm256_set1_epi8(static_cast<char>(0x80)), pos) &&
+                   scalar::is_ascii_utf8(str + pos, length - pos);
+        }
+
+        UNISTRING_TARGET_AVX2
+        bool is_ascii_utf16(char16_t const *str, std::size_t length) {
+            std::size_t pos = 0;
+            return is_ascii_blocks(reinterpret_cast<std::uint8_t const *>(str), 2 * length,
+                                   _mm256_set1_epi16(static_cast<short>(0xFF80)), pos) &&
+                   scalar::is_ascii_utf16(str + pos / 2, length - pos / 2);
+        }
+
+        UNISTRING_TARGET_AVX2
+        bool is_ascii_utf32(char32_t const *str, std::size_t length) {
+            std::size_t pos = 0;
+            return is_ascii_blocks(reinterpret_cast<std::uint8_t const *>(str), 4 * length,
+                                   _mm256_set1_epi32(static_cast<int>(0xFFFFFF80)), pos) &&
+                   scalar::is_ascii_utf32(str + pos / 4, length - pos / 4);
+        }
+    }
+#endif
+}
+
+// Latin-1 and Windows-1252
+
+namespace {
+    /*
+     * Code points of the Windows-1252 bytes 0x80 to 0x9F, the only ones where it departs from Latin-1. The five bytes
+     * it leaves undefined keep their C1 control, as web browsers do.
+     */
+    constexpr char16_t windows1252_c1[32] = {
+        0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+        0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+        0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+        0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+    };
+
+    namespace scalar {
+        inline char16_t legacy_codepoint(std::uint8_t byte, bool windows1252) {
+            return windows1252 && byte >= 0x80 && byte < 0xA0 ? windows1252_c1[byte - 0x80] : byte;
+        }
+
+        /**
+         * Returns the byte encoding the given code point, or -1 if the encoding lacks it.
+         */
+        inline int legacy_byte(char32_t codepoint, bool windows1252) {
+            if(codepoint < 0x80 || (codepoint <= 0xFF && (!windows1252 || codepoint >= 0xA0))) {
+                return static_cast<int>(codepoint);
+            } else if(!windows1252) {
+                return -1;
+            }
+
+            auto const found = std::find(windows1252_c1, windows1252_c1 + 32, codepoint);
+            return found != windows1252_c1 + 32 ? static_cast<int>(0x80 + (found - windows1252_c1)) : -1;
+        }
+
+        std::size_t utf8_length_from_legacy(std::uint8_t const *str, std::size_t length, bool windows1252) {
+            std::size_t count = length;
+            for(std::size_t pos = 0; pos < length; ++pos) {
+                char16_t const codepoint = legacy_codepoint(str[pos], windows1252);
+                count += (codepoint >= 0x80) + (codepoint >= 0x800);
+            }
+
+            return count;
+        }
+
+        std::size_t convert_legacy_to_utf8(std::uint8_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            std::size_t written = 0;
+            for(std::size_t pos = 0; pos < length; ++pos) {
+                written += encode_utf8(legacy_codepoint(str[pos], windows1252), out + written);
+            }
+
+            return written;
+        }
+
+        void convert_legacy_to_utf16(std::uint8_t const *str, std::size_t length, char16_t *out, bool windows1252) {
+            for(std::size_t pos = 0; pos < length; ++pos) {
+                out[pos] = legacy_codepoint(str[pos], windows1252);
+            }
+        }
+
+        void convert_legacy_to_utf32(std::uint8_t const *str, std::size_t length, char32_t *out, bool windows1252) {
+            for(std::size_t pos = 0; pos < length; ++pos) {
+                out[pos] = legacy_codepoint(str[pos], windows1252);
+            }
+        }
+
+        /**
+         * Encodes the code points of str starting before str + end, the last one possibly ending after it. Returns
+         * the position reached, which is less than end at an ill-formed sequence or a code point the encoding lacks.
+         */
+        inline std::size_t encode_utf8_as_legacy(std::uint8_t const *str, std::size_t pos, std::size_t end, std::size_t length,
+                                                 std::uint8_t *out, std::size_t &written, bool windows1252) {
+            while(pos < end) {
+                char32_t codepoint = 0;
+                std::size_t const consumed = decode_utf8(str + pos, length - pos, codepoint);
+                int const byte = consumed != 0 ? legacy_byte(codepoint, windows1252) : -1;
+                if(byte < 0) {
+                    break;
+                }
+                out[written++] = static_cast<std::uint8_t>(byte);
+                pos += consumed;
+            }
+
+            return pos;
+        }
+
+        conversion_result convert_utf8_to_legacy(std::uint8_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            std::size_t written = 0;
+            std::size_t const pos = encode_utf8_as_legacy(str, 0, length, length, out, written, windows1252);
+
+            return {pos, written};
+        }
+
+        template <typename UnitType>
+        conversion_result convert_units_to_legacy(UnitType const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            std::size_t pos = 0;
+            for(; pos < length; ++pos) {
+                // Surrogates are never part of a legacy encoding, so a pair stops the conversion like a lone one.
+                int const byte = legacy_byte(str[pos], windows1252);
+                if(byte < 0) {
+                    break;
+                }
+                out[pos] = static_cast<std::uint8_t>(byte);
+            }
+
+            return {pos, pos};
+        }
+
+        conversion_result convert_utf16_to_legacy(char16_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            return convert_units_to_legacy(str, length, out, windows1252);
+        }
+
+        conversion_result convert_utf32_to_legacy(char32_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            return convert_units_to_legacy(str, length, out, windows1252);
+        }
+    }
+
+    /*
+     * The vectorized kernels hand the blocks holding bytes 0x80 to 0x9F to the scalar ones when converting from or to
+     * Windows-1252; a Latin-1 block is only ever widened or narrowed.
+     */
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace sse_blocks {
+        /**
+         * Returns whether the given bytes include one in the range 0x80 to 0x9F, which compares as below -0x60.
+         */
+        UNISTRING_TARGET_SSE41 UNISTRING_ALWAYS_INLINE
+        inline bool has_c1_bytes(__m128i input) {
+            return _mm_movemask_epi8(_mm_cmplt_epi8(input, _mm_set1_epi8(static_cast<char>(0xA0)))) != 0;
+        }
+
+        /**
+         * Decodes the 16 bytes of UTF-8 at str + pos to Latin-1 if they are ASCII characters and whole 2-byte sequences
+         * with a C2 or C3 lead, advancing pos and written; up to 8 bytes past the decoded ones may be overwritten.
+         * Returns false, writing nothing, for the other blocks.
+         */
+        UNISTRING_TARGET_SSE41 UNISTRING_ALWAYS_INLINE
+        inline bool decode_latin1_block(
+            std::uint8_t const *str, std::size_t &pos, std::uint8_t *out, std::size_t &written, bool windows1252) {
+            __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+            unsigned const non_ascii = _mm_movemask_epi8(input);
+            if(non_ascii == 0) {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), input);
+                pos += 16;
+                written += 16;
+                return true;
+            }
+
+            __m128i const continuation_bytes =
+                _mm_cmpeq_epi8(_mm_and_si128(input, _mm_set1_epi8(static_cast<char>(0xC0))), _mm_set1_epi8(static_cast<char>(0x80)));
+            unsigned const leads = _mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_and_si128(input, _mm_set1_epi8(static_cast<char>(0xFE))), _mm_set1_epi8(static_cast<char>(0xC2))));
+            unsigned const continuations = _mm_movemask_epi8(continuation_bytes);
+            // A lead in the last byte shifts out of the continuation mask, leaving the block to the scalar code.
+            if(continuations != leads << 1 || (leads | continuations) != non_ascii) {
+                return false;
+            }
+
+            // The value of a continuation byte takes its low 6 bits, and the 2 low bits of its lead as the high ones.
+            __m128i const previous = _mm_slli_si128(input, 1);
+            __m128i const decoded = _mm_or_si128(_mm_and_si128(input, _mm_set1_epi8(0x3F)),
+                                                 _mm_slli_epi16(_mm_and_si128(previous, _mm_set1_epi8(0x03)), 6));
+            __m128i const values = _mm_blendv_epi8(input, decoded, continuation_bytes);
+            if(windows1252 && has_c1_bytes(values)) {
+                return false;
+            }
+
+            unsigned const kept = ~leads & 0xFFFF;
+            unsigned const low_kept = kept & 0xFF, high_kept = kept >> 8;
+            __m128i const low_shuffle = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(byte_compaction.shuffle[low_kept]));
+            __m128i const high_shuffle = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(byte_compaction.shuffle[high_kept]));
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(out + written), _mm_shuffle_epi8(values, low_shuffle));
+            written += __builtin_popcount(low_kept);
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(out + written), _mm_shuffle_epi8(_mm_srli_si128(values, 8), high_shuffle));
+            written += __builtin_popcount(high_kept);
+            pos += 16;
+            return true;
+        }
+    }
+
+    namespace sse41 {
+        UNISTRING_TARGET_SSE41
+        std::size_t utf8_length_from_legacy(std::uint8_t const *str, std::size_t length, bool windows1252) {
+            std::size_t pos = 0, count = length;
+            for(; pos + 16 <= length; pos += 16) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                if(windows1252 && sse_blocks::has_c1_bytes(input)) {
+                    count += scalar::utf8_length_from_legacy(str + pos, 16, windows1252) - 16;
+                    continue;
+                }
+                count += __builtin_popcount(_mm_movemask_epi8(input));
+            }
+
+            return count + scalar::utf8_length_from_legacy(str + pos, length - pos, windows1252) - (length - pos);
+        }
+
+        UNISTRING_TARGET_SSE41
+        std::size_t convert_legacy_to_utf8(std::uint8_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            // 16 bytes ahead of the block leave room for the bytes encode_bmp_utf8 may overwrite.
+            std::size_t pos = 0, written = 0;
+            for(; pos + 32 <= length; pos += 16) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                if(_mm_movemask_epi8(input) == 0) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + written), input);
+                    written += 16;
+                } else if(windows1252 && sse_blocks::has_c1_bytes(input)) {
+                    written += scalar::convert_legacy_to_utf8(str + pos, 16, out + written, windows1252);
+                } else {
+                    sse_blocks::encode_bmp_utf8(_mm_cvtepu8_epi16(input), out, written);
+                    sse_blocks::encode_bmp_utf8(_mm_cvtepu8_epi16(_mm_srli_si128(input, 8)), out, written);
+                }
+            }
+
+            return written + scalar::convert_legacy_to_utf8(str + pos, length - pos, out + written, windows1252);
+        }
+
+        UNISTRING_TARGET_SSE41
+        void convert_legacy_to_utf16(std::uint8_t const *str, std::size_t length, char16_t *out, bool windows1252) {
+            std::size_t pos = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                if(windows1252 && sse_blocks::has_c1_bytes(input)) {
+                    scalar::convert_legacy_to_utf16(str + pos, 16, out + pos, windows1252);
+                    continue;
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos), _mm_cvtepu8_epi16(input));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos + 8), _mm_cvtepu8_epi16(_mm_srli_si128(input, 8)));
+            }
+            scalar::convert_legacy_to_utf16(str + pos, length - pos, out + pos, windows1252);
+        }
+
+        UNISTRING_TARGET_SSE41
+        void convert_legacy_to_utf32(std::uint8_t const *str, std::size_t length, char32_t *out, bool windows1252) {
+            std::size_t pos = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                if(windows1252 && sse_blocks::has_c1_bytes(input)) {
+                    scalar::convert_legacy_to_utf32(str + pos, 16, out + pos, windows1252);
+                    continue;
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos), _mm_cvtepu8_epi32(input));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos + 4), _mm_cvtepu8_epi32(_mm_srli_si128(input, 4)));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos + 8), _mm_cvtepu8_epi32(_mm_srli_si128(input, 8)));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos + 12), _mm_cvtepu8_epi32(_mm_srli_si128(input, 12)));
+            }
+            scalar::convert_legacy_to_utf32(str + pos, length - pos, out + pos, windows1252);
+        }
+
+        UNISTRING_TARGET_SSE41
+        conversion_result convert_utf8_to_legacy(std::uint8_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            std::size_t pos = 0, written = 0;
+            while(pos + 16 <= length) {
+                if(sse_blocks::decode_latin1_block(str, pos, out, written, windows1252)) {
+                    continue;
+                }
+                std::size_t const end = pos + 16;
+                pos = scalar::encode_utf8_as_legacy(str, pos, end, length, out, written, windows1252);
+                if(pos < end) {
+                    return {pos, written};
+                }
+            }
+            pos = scalar::encode_utf8_as_legacy(str, pos, length, length, out, written, windows1252);
+
+            return {pos, written};
+        }
+
+        UNISTRING_TARGET_SSE41
+        conversion_result convert_utf16_to_legacy(char16_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            std::size_t pos = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                __m128i const low = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                __m128i const high = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos + 8));
+                __m128i const packed = _mm_packus_epi16(low, high);
+                if(!_mm_testz_si128(_mm_or_si128(low, high), _mm_set1_epi16(static_cast<short>(0xFF00))) ||
+                   (windows1252 && sse_blocks::has_c1_bytes(packed))) {
+                    auto block = scalar::convert_utf16_to_legacy(str + pos, 16, out + pos, windows1252);
+                    if(block.read < 16) {
+                        return {pos + block.read, pos + block.written};
+                    }
+                    continue;
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos), packed);
+            }
+            auto tail = scalar::convert_utf16_to_legacy(str + pos, length - pos, out + pos, windows1252);
+
+            return {pos + tail.read, pos + tail.written};
+        }
+
+        UNISTRING_TARGET_SSE41
+        conversion_result convert_utf32_to_legacy(char32_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            std::size_t pos = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                __m128i const first = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                __m128i const second = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos + 4));
+                __m128i const third = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos + 8));
+                __m128i const fourth = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos + 12));
+                __m128i const packed =
+                    _mm_packus_epi16(_mm_packus_epi32(first, second), _mm_packus_epi32(third, fourth));
+                __m128i const any = _mm_or_si128(_mm_or_si128(first, second), _mm_or_si128(third, fourth));
+                if(!_mm_testz_si128(any, _mm_set1_epi32(static_cast<int>(0xFFFFFF00))) ||
+                   (windows1252 && sse_blocks::has_c1_bytes(packed))) {
+                    auto block = scalar::convert_utf32_to_legacy(str + pos, 16, out + pos, windows1252);
+                    if(block.read < 16) {
+                        return {pos + block.read, pos + block.written};
+                    }
+                    continue;
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + pos), packed);
+            }
+            auto tail = scalar::convert_utf32_to_legacy(str + pos, length - pos, out + pos, windows1252);
+
+            return {pos + tail.read, pos + tail.written};
+        }
+    }
+
+    namespace avx2 {
+        UNISTRING_TARGET_AVX2
+        inline bool has_c1_bytes(__m256i input) {
+            return _mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(0xA0)), input)) != 0;
+        }
+
+        UNISTRING_TARGET_AVX2
+        std::size_t utf8_length_from_legacy(std::uint8_t const *str, std::size_t length, bool windows1252) {
+            std::size_t pos = 0, count = length;
+            for(; pos + 32 <= length; pos += 32) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                if(windows1252 && has_c1_bytes(input)) {
+                    count += scalar::utf8_length_from_legacy(str + pos, 32, windows1252) - 32;
+                    continue;
+                }
+                count += __builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(input)));
+            }
+
+            return count + scalar::utf8_length_from_legacy(str + pos, length - pos, windows1252) - (length - pos);
+        }
+
+        UNISTRING_TARGET_AVX2
+        std::size_t convert_legacy_to_utf8(std::uint8_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            // 16 bytes ahead of the block leave room for the bytes encode_bmp_utf8 may overwrite.
+            std::size_t pos = 0, written = 0;
+            for(; pos + 48 <= length; pos += 32) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                if(_mm256_movemask_epi8(input) == 0) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written), input);
+                    written += 32;
+                } else if(windows1252 && has_c1_bytes(input)) {
+                    written += scalar::convert_legacy_to_utf8(str + pos, 32, out + written, windows1252);
+                } else {
+                    __m128i const low = _mm256_castsi256_si128(input), high = _mm256_extracti128_si256(input, 1);
+                    sse_blocks::encode_bmp_utf8(_mm_cvtepu8_epi16(low), out, written);
+                    sse_blocks::encode_bmp_utf8(_mm_cvtepu8_epi16(_mm_srli_si128(low, 8)), out, written);
+                    sse_blocks::encode_bmp_utf8(_mm_cvtepu8_epi16(high), out, written);
+                    sse_blocks::encode_bmp_utf8(_mm_cvtepu8_epi16(_mm_srli_si128(high, 8)), out, written);
+                }
+            }
+
+            return written + scalar::convert_legacy_to_utf8(str + pos, length - pos, out + written, windows1252);
+        }
+
+        UNISTRING_TARGET_AVX2
+        void convert_legacy_to_utf16(std::uint8_t const *str, std::size_t length, char16_t *out, bool windows1252) {
+            std::size_t pos = 0;
+            for(; pos + 32 <= length; pos += 32) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                if(windows1252 && has_c1_bytes(input)) {
+                    scalar::convert_legacy_to_utf16(str + pos, 32, out + pos, windows1252);
+                    continue;
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + pos), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(input)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + pos + 16),
+                                    _mm256_cvtepu8_epi16(_mm256_extracti128_si256(input, 1)));
+            }
+            scalar::convert_legacy_to_utf16(str + pos, length - pos, out + pos, windows1252);
+        }
+
+        UNISTRING_TARGET_AVX2
+        void convert_legacy_to_utf32(std::uint8_t const *str, std::size_t length, char32_t *out, bool windows1252) {
+            std::size_t pos = 0;
+            for(; pos + 32 <= length; pos += 32) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                if(windows1252 && has_c1_bytes(input)) {
+                    scalar::convert_legacy_to_utf32(str + pos, 32, out + pos, windows1252);
+                    continue;
+                }
+                __m128i const low = _mm256_castsi256_si128(input), high = _mm256_extracti128_si256(input, 1);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + pos), _mm256_cvtepu8_epi32(low));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + pos + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + pos + 16), _mm256_cvtepu8_epi32(high));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + pos + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+            }
+            scalar::convert_legacy_to_utf32(str + pos, length - pos, out + pos, windows1252);
+        }
+
+        UNISTRING_TARGET_AVX2
+        conversion_result convert_utf8_to_legacy(std::uint8_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            std::size_t pos = 0, written = 0;
+            while(pos + 32 <= length) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                if(_mm256_movemask_epi8(input) == 0) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + written), input);
+                    pos += 32;
+                    written += 32;
+                    continue;
+                }
+                if(sse_blocks::decode_latin1_block(str, pos, out, written, windows1252)) {
+                    continue;
+                }
+                std::size_t const end = pos + 16;
+                pos = scalar::encode_utf8_as_legacy(str, pos, end, length, out, written, windows1252);
+                if(pos < end) {
+                    return {pos, written};
+                }
+            }
+            while(pos + 16 <= length) {
+                if(sse_blocks::decode_latin1_block(str, pos, out, written, windows1252)) {
+                    continue;
+                }
+                std::size_t const end = pos + 16;
+                pos = scalar::encode_utf8_as_legacy(str, pos, end, length, out, written, windows1252);
+                if(pos < end) {
+                    return {pos, written};
+                }
+            }
+            pos = scalar::encode_utf8_as_legacy(str, pos, length, length, out, written, windows1252);
+
+            return {pos, written};
+        }
+
+        UNISTRING_TARGET_AVX2
+        conversion_result convert_utf16_to_legacy(char16_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            std::size_t pos = 0;
+            for(; pos + 32 <= length; pos += 32) {
+                __m256i const low = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                __m256i const high = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos + 16));
+                __m256i const packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8);
+                if(!_mm256_testz_si256(_mm256_or_si256(low, high), _mm256_set1_epi16(static_cast<short>(0xFF00))) ||
+                   (windows1252 && has_c1_bytes(packed))) {
+                    auto block = scalar::convert_utf16_to_legacy(str + pos, 32, out + pos, windows1252);
+                    if(block.read < 32) {
+                        return {pos + block.read, pos + block.written};
+                    }
+                    continue;
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + pos), packed);
+            }
+            auto tail = scalar::convert_utf16_to_legacy(str + pos, length - pos, out + pos, windows1252);
+
+            return {pos + tail.read, pos + tail.written};
+        }
+
+        UNISTRING_TARGET_AVX2
+        conversion_result convert_utf32_to_legacy(char32_t const *str, std::size_t length, std::uint8_t *out, bool windows1252) {
+            std::size_t pos = 0;
+            for(; pos + 32 <= length; pos += 32) {
+                __m256i const first = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                __m256i const second = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos + 8));
+                __m256i const third = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos + 16));
+                __m256i const fourth = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos + 24));
+                // The packs work within 128-bit lanes, leaving groups of 4 bytes to put back in order.
+                __m256i const interleaved =
+                    _mm256_packus_epi16(_mm256_packus_epi32(first, second), _mm256_packus_epi32(third, fourth));
+                __m256i const packed = _mm256_permutevar8x32_epi32(interleaved, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+                __m256i const any = _mm256_or_si256(_mm256_or_si256(first, second), _mm256_or_si256(third, fourth));
+                if(!_mm256_testz_si256(any, _mm256_set1_epi32(static_cast<int>(0xFFFFFF00))) ||
+                   (windows1252 && has_c1_bytes(packed))) {
+                    auto block = scalar::convert_utf32_to_legacy(str + pos, 32, out + pos, windows1252);
+                    if(block.read < 32) {
+                        return {pos + block.read, pos + block.written};
+                    }
+                    continue;
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + pos), packed);
+            }
+            auto tail = scalar::convert_utf32_to_legacy(str + pos, length - pos, out + pos, windows1252);
+
+            return {pos + tail.read, pos + tail.written};
+        }
+    }
+#endif
+}
+
+// Code point indexing
+
+namespace {
+    /*
+     * Only the units starting a code point are looked at: the bytes that are not continuation bytes in UTF-8, and the
+     * units that are not low surrogates in UTF-16.
+     */
+    namespace scalar {
+        template <typename UnitType, typename IsStart>
+        std::size_t advance_codepoints(UnitType const *str, std::size_t length, std::size_t count, IsStart is_start) {
+            for(std::size_t pos = 0; pos < length; ++pos) {
+                if(is_start(str[pos]) && count-- == 0) {
+                    return pos;
+                }
+            }
+
+            return length;
+        }
+
+        std::size_t advance_utf8(std::uint8_t const *str, std::size_t length, std::size_t count) {
+            return advance_codepoints(str, length, count, [](std::uint8_t byte) { return (byte & 0xC0) != 0x80; });
+        }
+
+        std::size_t advance_utf16(char16_t const *str, std::size_t length, std::size_t count) {
+            return advance_codepoints(str, length, count, [](char16_t unit) { return (unit & 0xFC00) != 0xDC00; });
+        }
+
+        /**
+         * Returns the position of the set bit of mask that has count set bits below it.
+         */
+        inline std::size_t nth_set_bit(unsigned mask, std::size_t count) {
+            for(; count > 0; --count) {
+                mask &= mask - 1;
+            }
+
+            return __builtin_ctz(mask);
+        }
+    }
+
+    /*
+     * The vectorized kernels skip the blocks holding fewer starts than remain to be skipped, one popcount each, and
+     * look for the right bit in the mask of the last one.
+     */
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace sse41 {
+        UNISTRING_TARGET_SSE41
+        std::size_t advance_utf8(std::uint8_t const *str, std::size_t length, std::size_t count) {
+            __m128i const last_continuation = _mm_set1_epi8(static_cast<char>(0xBF));
+            std::size_t pos = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                unsigned const starts = _mm_movemask_epi8(_mm_cmpgt_epi8(input, last_continuation));
+                std::size_t const block_count = __builtin_popcount(starts);
+                if(count < block_count) {
+                    return pos + scalar::nth_set_bit(starts, count);
+                }
+                count -= block_count;
+            }
+
+            return pos + scalar::advance_utf8(str + pos, length - pos, count);
+        }
+
+        UNISTRING_TARGET_SSE41
+        std::size_t advance_utf16(char16_t const *str, std::size_t length, std::size_t count) {
+            __m128i const low_surrogate_mask = _mm_set1_epi16(static_cast<short>(0xFC00));
+            __m128i const low_surrogate_bits = _mm_set1_epi16(static_cast<short>(0xDC00));
+            std::size_t pos = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                __m128i const low = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                __m128i const high = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos + 8));
+                __m128i const low_surrogates =
+                    _mm_packs_epi16(_mm_cmpeq_epi16(_mm_and_si128(low, low_surrogate_mask), low_surrogate_bits),
+                                    _mm_cmpeq_epi16(_mm_and_si128(high, low_surrogate_mask), low_surrogate_bits));
+                unsigned const starts = ~_mm_movemask_epi8(low_surrogates) & 0xFFFF;
+                std::size_t const block_count = __builtin_popcount(starts);
+                if(count < block_count) {
+                    return pos + scalar::nth_set_bit(starts, count);
+                }
+                count -= block_count;
+            }
+
+            return pos + scalar::advance_utf16(str + pos, length - pos, count);
+        }
+    }
+
+    namespace avx2 {
+        UNISTRING_TARGET_AVX2
+        std::size_t advance_utf8(std::uint8_t const *str, std::size_t length, std::size_t count) {
+            __m256i const last_continuation = _mm256_set1_epi8(static_cast<char>(0xBF));
+            std::size_t pos = 0;
+            for(; pos + 32 <= length; pos += 32) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                unsigned const starts = _mm256_movemask_epi8(_mm256_cmpgt_epi8(input, last_continuation));
+                std::size_t const block_count = __builtin_popcount(starts);
+                if(count < block_count) {
+                    return pos + scalar::nth_set_bit(starts, count);
+                }
+                count -= block_count;
+            }
+
+            return pos + scalar::advance_utf8(str + pos, length - pos, count);
+        }
+
+        UNISTRING_TARGET_AVX2
+        std::size_t advance_utf16(char16_t const *str, std::size_t length, std::size_t count) {
+            __m256i const low_surrogate_mask = _mm256_set1_epi16(static_cast<short>(0xFC00));
+            __m256i const low_surrogate_bits = _mm256_set1_epi16(static_cast<short>(0xDC00));
+            std::size_t pos = 0;
+            for(; pos + 32 <= length; pos += 32) {
+                __m256i const low = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                __m256i const high = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos + 16));
+                // The pack works within 128-bit lanes, leaving the middle quarters to swap.
+                __m256i const low_surrogates = _mm256_permute4x64_epi64(
+                    _mm256_packs_epi16(_mm256_cmpeq_epi16(_mm256_and_si256(low, low_surrogate_mask), low_surrogate_bits),
+                                       _mm256_cmpeq_epi16(_mm256_and_si256(high, low_surrogate_mask), low_surrogate_bits)),
+                    0xD8);
+                unsigned const starts = ~static_cast<unsigned>(_mm256_movemask_epi8(low_surrogates));
+                std::size_t const block_count = __builtin_popcount(starts);
+                if(count < block_count) {
+                    return pos + scalar::nth_set_bit(starts, count);
+                }
+                count -= block_count;
+            }
+
+            return pos + scalar::advance_utf16(str + pos, length - pos, count);
+        }
+    }
+#endif
+}
+
+// Normalization quick check
+
+namespace {
+    /*
+     * The code points below the first one a normalization form may change or reorder are skipped in bulk, as the
+     * prefix of units below a bound: the first lead byte of those code points in UTF-8, the code point itself in UTF-16
+     * and UTF-32.
+     */
+    namespace scalar {
+        template <typename UnitType>
+        std::size_t length_below(UnitType const *str, std::size_t length, UnitType bound) {
+            std::size_t pos = 0;
+            while(pos < length && str[pos] < bound) {
+                ++pos;
+            }
+
+            return pos;
+        }
+
+        std::size_t length_below_utf8(std::uint8_t const *str, std::size_t length, std::uint8_t bound) {
+            return length_below(str, length, bound);
+        }
+
+        std::size_t length_below_utf16(char16_t const *str, std::size_t length, char16_t bound) {
+            return length_below(str, length, bound);
+        }
+
+        std::size_t length_below_utf32(char32_t const *str, std::size_t length, char32_t bound) {
+            return length_below(str, length, bound);
+        }
+    }
+
+    /*
+     * A unit is below the bound when its unsigned minimum with the bound minus one is itself. The byte mask of a block
+     * has as many bits per unit as the unit has bytes.
+     */
+
+#if UNISTRING_HAS_X86_KERNELS
+    namespace sse41 {
+        UNISTRING_TARGET_SSE41
+        std::size_t length_below_utf8(std::uint8_t const *str, std::size_t length, std::uint8_t bound) {
+            __m128i const maximum = _mm_set1_epi8(static_cast<char>(bound - 1));
+            std::size_t pos = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                unsigned const below = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(input, maximum), input));
+                if(below != 0xFFFF) {
+                    return pos + __builtin_ctz(~below);
+                }
+            }
+
+            return pos + scalar::length_below(str + pos, length - pos, bound);
+        }
+
+        UNISTRING_TARGET_SSE41
+        std::size_t length_below_utf16(char16_t const *str, std::size_t length, char16_t bound) {
+            __m128i const maximum = _mm_set1_epi16(static_cast<short>(bound - 1));
+            std::size_t pos = 0;
+            for(; pos + 8 <= length; pos += 8) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                unsigned const below = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_min_epu16(input, maximum), input));
+                if(below != 0xFFFF) {
+                    return pos + __builtin_ctz(~below) / 2;
+                }
+            }
+
+            return pos + scalar::length_below(str + pos, length - pos, bound);
+        }
+
+        UNISTRING_TARGET_SSE41
+        std::size_t length_below_utf32(char32_t const *str, std::size_t length, char32_t bound) {
+            __m128i const maximum = _mm_set1_epi32(static_cast<int>(bound - 1));
+            std::size_t pos = 0;
+            for(; pos + 4 <= length; pos += 4) {
+                __m128i const input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(str + pos));
+                unsigned const below = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_min_epu32(input, maximum), input));
+                if(below != 0xFFFF) {
+                    return pos + __builtin_ctz(~below) / 4;
+                }
+            }
+
+            return pos + scalar::length_below(str + pos, length - pos, bound);
+        }
+    }
+
+    namespace avx2 {
+        UNISTRING_TARGET_AVX2
+        std::size_t length_below_utf8(std::uint8_t const *str, std::size_t length, std::uint8_t bound) {
+            __m256i const maximum = _mm256_set1_epi8(static_cast<char>(bound - 1));
+            std::size_t pos = 0;
+            for(; pos + 32 <= length; pos += 32) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                unsigned const below = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(input, maximum), input));
+                if(below != 0xFFFFFFFF) {
+                    return pos + __builtin_ctz(~below);
+                }
+            }
+
+            return pos + scalar::length_below(str + pos, length - pos, bound);
+        }
+
+        UNISTRING_TARGET_AVX2
+        std::size_t length_below_utf16(char16_t const *str, std::size_t length, char16_t bound) {
+            __m256i const maximum = _mm256_set1_epi16(static_cast<short>(bound - 1));
+            std::size_t pos = 0;
+            for(; pos + 16 <= length; pos += 16) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                unsigned const below = _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_min_epu16(input, maximum), input));
+                if(below != 0xFFFFFFFF) {
+                    return pos + __builtin_ctz(~below) / 2;
+                }
+            }
+
+            return pos + scalar::length_below(str + pos, length - pos, bound);
+        }
+
+        UNISTRING_TARGET_AVX2
+        std::size_t length_below_utf32(char32_t const *str, std::size_t length, char32_t bound) {
+            __m256i const maximum = _mm256_set1_epi32(static_cast<int>(bound - 1));
+            std::size_t pos = 0;
+            for(; pos + 8 <= length; pos += 8) {
+                __m256i const input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(str + pos));
+                unsigned const below = _mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_min_epu32(input, maximum), input));
+                if(below != 0xFFFFFFFF) {
+                    return pos + __builtin_ctz(~below) / 4;
+                }
+            }
+
+            return pos + scalar::length_below(str + pos, length - pos, bound);
+        }
+    }
+#endif
+}
+
+// Dispatch
+
+namespace {
+    /*
+     * The kernels of one instruction set, bound once for all on first use. They work on bytes; the public functions
+     * do the casts.
+     */
+    struct kernel_table {
+        char const *isa;
+        bool (*validate_utf8)(std::uint8_t const *, std::size_t);
+        std::size_t (*utf16_length_from_utf32)(char32_t const *, std::size_t);
+        conversion_result (*convert_utf32_to_utf16)(char32_t const *, std::size_t, char16_t *);
+        std::size_t (*utf32_length_from_utf16)(char16_t const *, std::size_t);
+        conversion_result (*convert_utf16_to_utf32)(char16_t const *, std::size_t, char32_t *);
+        std::size_t (*utf16_length_from_utf8)(std::uint8_t const *, std::size_t, bool &);
+        conversion_result (*convert_utf8_to_utf16)(std::uint8_t const *, std::size_t, char16_t *);
+        std::size_t (*utf8_length_from_utf16)(char16_t const *, std::size_t);
+        conversion_result (*convert_utf16_to_utf8)(char16_t const *, std::size_t, std::uint8_t *);
+        std::size_t (*utf8_length_from_utf32)(char32_t const *, std::size_t);
+        conversion_result (*convert_utf32_to_utf8)(char32_t const *, std::size_t, std::uint8_t *);
+        std::size_t (*utf32_length_from_utf8)(std::uint8_t const *, std::size_t, bool &);
+        conversion_result (*convert_utf8_to_utf32)(std::uint8_t const *, std::size_t, char32_t *);
+        bool (*is_ascii_utf8)(std::uint8_t const *, std::size_t);
+        bool (*is_ascii_utf16)(char16_t const *, std::size_t);
+        bool (*is_ascii_utf32)(char32_t const *, std::size_t);
+        std::size_t (*utf8_length_from_legacy)(std::uint8_t const *, std::size_t, bool);
+        std::size_t (*convert_legacy_to_utf8)(std::uint8_t const *, std::size_t, std::uint8_t *, bool);
+        void (*convert_legacy_to_utf16)(std::uint8_t const *, std::size_t, char16_t *, bool);
+        void (*convert_legacy_to_utf32)(std::uint8_t const *, std::size_t, char32_t *, bool);
+        conversion_result (*convert_utf8_to_legacy)(std::uint8_t const *, std::size_t, std::uint8_t *, bool);
+        conversion_result (*convert_utf16_to_legacy)(char16_t const *, std::size_t, std::uint8_t *, bool);
+        conversion_result (*convert_utf32_to_legacy)(char32_t const *, std::size_t, std::uint8_t *, bool);
+        std::size_t (*advance_utf8)(std::uint8_t const *, std::size_t, std::size_t);
+        std::size_t (*advance_utf16)(char16_t const *, std::size_t, std::size_t);
+        std::size_t (*length_below_utf8)(std::uint8_t const *, std::size_t, std::uint8_t);
+        std::size_t (*length_below_utf16)(char16_t const *, std::size_t, char16_t);
+        std::size_t (*length_below_utf32)(char32_t const *, std::size_t, char32_t);
+    };
+
+#define UNISTRING_KERNEL_TABLE(isa)                                                                                   \
+    kernel_table {                                                                                                    \
+        #isa,                                                                                                         \
+        isa::validate_utf8,                                                                                           \
+        isa::utf16_length_from_utf32,                                                                                 \
+        isa::convert_utf32_to_utf16,                                                                                  \
+        isa::utf32_length_from_utf16,                                                                                 \
+        isa::convert_utf16_to_utf32,                                                                                  \
+        isa::utf16_length_from_utf8,                                                                                  \
+        isa::convert_utf8_to_utf16,                                                                                   \
+        isa::utf8_length_from_utf16,                                                                                  \
+        isa::convert_utf16_to_utf8,                                                                                   \
+        isa::utf8_length_from_utf32,                                                                                  \
+        isa::convert_utf32_to_utf8,                                                                                   \
+        isa::utf32_length_from_utf8,                                                                                  \
+        isa::convert_utf8_to_utf32,                                                                                   \
+        isa::is_ascii_utf8,                                                                                           \
+        isa::is_ascii_utf16,                                                                                          \
+        isa::is_ascii_utf32,                                                                                          \
+        isa::utf8_length_from_legacy,                                                                                 \
+        isa::convert_legacy_to_utf8,                                                                                  \
+        isa::convert_legacy_to_utf16,                                                                                 \
+        isa::convert_legacy_to_utf32,                                                                                 \
+        isa::convert_utf8_to_legacy,                                                                                  \
+        isa::convert_utf16_to_legacy,                                                                                 \
+        isa::convert_utf32_to_legacy,                                                                                 \
+        isa::advance_utf8,                                                                                            \
+        isa::advance_utf16,                                                                                           \
+        isa::length_below_utf8,                                                                                       \
+        isa::length_below_utf16,                                                                                      \
+        isa::length_below_utf32,                                                                                      \
+    }
+
+    constexpr kernel_table scalar_kernels = UNISTRING_KERNEL_TABLE(scalar);
+#if UNISTRING_HAS_X86_KERNELS
+    constexpr kernel_table sse41_kernels = UNISTRING_KERNEL_TABLE(sse41);
+    constexpr kernel_table avx2_kernels = UNISTRING_KERNEL_TABLE(avx2);
+#endif
+#undef UNISTRING_KERNEL_TABLE
+
+#if UNISTRING_HAS_X86_KERNELS
+    bool cpu_supports_sse41() {
+        unsigned eax, ebx, ecx, edx;
+        return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_1) && (ecx & bit_POPCNT);
+    }
+
+    bool cpu_supports_avx2() {
+        unsigned eax, ebx, ecx, edx;
+        if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_OSXSAVE) || !(ecx & bit_AVX) || !(ecx & bit_POPCNT)) {
+            return false;
+        }
+
+        // The OS must also save the YMM registers on context switches.
+        unsigned xcr0_low, xcr0_high;
+        __asm__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+        if((xcr0_low & 0x6) != 0x6 || __get_cpuid_max(0, nullptr) < 7) {
+            return false;
+        }
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+        return (ebx & bit_AVX2) != 0;
+    }
+#endif
+
+    /**
+     * Returns the kernels of the best instruction set the CPU supports. The UNISTRING_ISA environment variable, set to
+     * "scalar" or "sse41", caps the choice so that the slower kernels can be exercised on any machine.
+     */
+    kernel_table const &select_kernels() {
+        char const *requested = std::getenv("UNISTRING_ISA");
+        bool const scalar_only = requested != nullptr && std::strcmp(requested, "scalar") == 0;
+        bool const up_to_sse41 = requested != nullptr && std::strcmp(requested, "sse41") == 0;
+
+#if UNISTRING_HAS_X86_KERNELS
+        if(!scalar_only && !up_to_sse41 && cpu_supports_avx2()) {
+            return avx2_kernels;
+        }
+        if(!scalar_only && cpu_supports_sse41()) {
+            return sse41_kernels;
+        }
+#else
+        (void)scalar_only;
+        (void)up_to_sse41;
+#endif
+
+        return scalar_kernels;
+    }
+
+    kernel_table const &kernels() {
+        static kernel_table const &table = select_kernels();
+        return table;
+    }
+}
+
+namespace unistring_kernels {
+    char const *active_isa() {
+        return kernels().isa;
+    }
+
+    bool validate_utf8(char const *str, std::size_t length) {
+        auto bytes = reinterpret_cast<std::uint8_t const *>(str);
+        if(length < 16) {
+            return scalar::validate_utf8(bytes, length);
+        }
+
+        return kernels().validate_utf8(bytes, length);
+    }
+
+    std::size_t utf16_length_from_utf32(char32_t const *str, std::size_t length) {
+        return kernels().utf16_length_from_utf32(str, length);
+    }
+
+    conversion_result convert_utf32_to_utf16(char32_t const *str, std::size_t length, char16_t *out) {
+        return kernels().convert_utf32_to_utf16(str, length, out);
+    }
+
+    std::size_t utf32_length_from_utf16(char16_t const *str, std::size_t length) {
+        return kernels().utf32_length_from_utf16(str, length);
+    }
+
+    conversion_result convert_utf16_to_utf32(char16_t const *str, std::size_t length, char32_t *out) {
+        return kernels().convert_utf16_to_utf32(str, length, out);
+    }
+
+    std::size_t utf16_length_from_utf8(char const *str, std::size_t length) {
+        bool ascii;
+        return utf16_length_from_utf8(str, length, ascii);
+    }
+
+    std::size_t utf16_length_from_utf8(char const *str, std::size_t length, bool &ascii) {
+        auto bytes = reinterpret_cast<std::uint8_t const *>(str);
+        return kernels().utf16_length_from_utf8(bytes, length, ascii);
+    }
+
+    conversion_result convert_utf8_to_utf16(char const *str, std::size_t length, char16_t *out) {
+        auto bytes = reinterpret_cast<std::uint8_t const *>(str);
+        return kernels().convert_utf8_to_utf16(bytes, length, out);
+    }
+
+    std::size_t utf8_length_from_utf16(char16_t const *str, std::size_t length) {
+        return kernels().utf8_length_from_utf16(str, length);
+    }
+
+    conversion_result convert_utf16_to_utf8(char16_t const *str, std::size_t length, char *out) {
+        auto bytes = reinterpret_cast<std::uint8_t *>(out);
+        return kernels().convert_utf16_to_utf8(str, length, bytes);
+    }
+
+    std::size_t utf8_length_from_utf32(char32_t const *str, std::size_t length) {
+        return kernels().utf8_length_from_utf32(str, length);
+    }
+
+    conversion_result convert_utf32_to_utf8(char32_t const *str, std::size_t length, char *out) {
+        auto bytes = reinterpret_cast<std::uint8_t *>(out);
+        return kernels().convert_utf32_to_utf8(str, length, bytes);
+    }
+
+    std::size_t utf32_length_from_utf8(char const *str, std::size_t length) {
+        bool ascii;
+        return utf32_length_from_utf8(str, length, ascii);
+    }
+
+    std::size_t utf32_length_from_utf8(char const *str, std::size_t length, bool &ascii) {
+        auto bytes = reinterpret_cast<std::uint8_t const *>(str);
+        return kernels().utf32_length_from_utf8(bytes, length, ascii);
+    }
+
+    conversion_result convert_utf8_to_utf32(char const *str, std::size_t length, char32_t *out) {
+        auto bytes = reinterpret_cast<std::uint8_t const *>(str);
+        return kernels().convert_utf8_to_utf32(bytes, length, out);
+    }
+
+    bool is_ascii(char const *str, std::size_t length) {
+        return kernels().is_ascii_utf8(reinterpret_cast<std::uint8_t const *>(str), length);
+    }
+
+    bool is_ascii(char16_t const *str, std::size_t length) {
+        return kernels().is_ascii_utf16(str, length);
+    }
+
+    bool is_ascii(char32_t const *str, std::size_t length) {
+        return kernels().is_ascii_utf32(str, length);
+    }
+
+    std::size_t utf8_length_from_legacy(legacy_encoding encoding, char const *str, std::size_t length) {
+        return kernels().utf8_length_from_legacy(
+            reinterpret_cast<std::uint8_t const *>(str), length, encoding == legacy_encoding::windows1252);
+    }
+
+    std::size_t convert_legacy_to_utf8(legacy_encoding encoding, char const *str, std::size_t length, char *out) {
+        return kernels().convert_legacy_to_utf8(reinterpret_cast<std::uint8_t const *>(str), length,
+                                                reinterpret_cast<std::uint8_t *>(out), encoding == legacy_encoding::windows1252);
+    }
+
+    void convert_legacy_to_utf16(legacy_encoding encoding, char const *str, std::size_t length, char16_t *out) {
+        kernels().convert_legacy_to_utf16(
+            reinterpret_cast<std::uint8_t const *>(str), length, out, encoding == legacy_encoding::windows1252);
+    }
+
+    void convert_legacy_to_utf32(legacy_encoding encoding, char const *str, std::size_t length, char32_t *out) {
+        kernels().convert_legacy_to_utf32(
+            reinterpret_cast<std::uint8_t const *>(str), length, out, encoding == legacy_encoding::windows1252);
+    }
+
+    conversion_result convert_utf8_to_legacy(legacy_encoding encoding, char const *str, std::size_t length, char *out) {
+        return kernels().convert_utf8_to_legacy(reinterpret_cast<std::uint8_t const *>(str), length,
+                                                reinterpret_cast<std::uint8_t *>(out), encoding == legacy_encoding::windows1252);
+    }
+
+    conversion_result convert_utf16_to_legacy(legacy_encoding encoding, char16_t const *str, std::size_t length, char *out) {
+        return kernels().convert_utf16_to_legacy(
+            str, length, reinterpret_cast<std::uint8_t *>(out), encoding == legacy_encoding::windows1252);
+    }
+
+    conversion_result convert_utf32_to_legacy(legacy_encoding encoding, char32_t const *str, std::size_t length, char *out) {
+        return kernels().convert_utf32_to_legacy(
+            str, length, reinterpret_cast<std::uint8_t *>(out), encoding == legacy_encoding::windows1252);
+    }
+
+    std::size_t advance_utf8(char const *str, std::size_t length, std::size_t count) {
+        return kernels().advance_utf8(reinterpret_cast<std::uint8_t const *>(str), length, count);
+    }
+
+    std::size_t advance_utf16(char16_t const *str, std::size_t length, std::size_t count) {
+        return kernels().advance_utf16(str, length, count);
+    }
+
+    std::size_t length_below(char const *str, std::size_t length, unsigned char bound) {
+        return kernels().length_below_utf8(reinterpret_cast<std::uint8_t const *>(str), length, bound);
+    }
+
+    std::size_t length_below(char16_t const *str, std::size_t length, char16_t bound) {
+        return kernels().length_below_utf16(str, length, bound);
+    }
+
+    std::size_t length_below(char32_t const *str, std::size_t length, char32_t bound) {
+        return kernels().length_below_utf32(str, length, bound);
+    }
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  unistring_kernels.h
+//
+//  Buffer-level Unicode routines used by basic_unistring. Each of them has a scalar implementation and, on x86, SSE4.1
+//  and AVX2 ones, the best of which the CPU supports being picked on first use.
+//
+
+#ifndef unistring_kernels_hpp
+#define unistring_kernels_hpp
+
+#include <cstddef>
+
+namespace unistring_kernels {
+    /**
+     * Outcome of a conversion: the number of input units consumed and of output units produced. The conversion stops
+     * at the first ill-formed input sequence, in which case read is less than the input length.
+     */
+    struct conversion_result {
+        std::size_t read;
+        std::size_t written;
+    };
+
+    /**
+     * Returns the name of the instruction set the kernels run with: "avx2", "sse41" or "scalar". The UNISTRING_ISA
+     * environment variable can lower it, e.g. to test the scalar kernels.
+     */
+    char const *active_isa();
+
+    /**
+     * Returns whether the given buffer is well-formed UTF-8, i.e. contains no overlong form, surrogate, code point
+     * above U+10FFFF or truncated sequence.
+     */
+    bool validate_utf8(char const *str, std::size_t length);
+
+    /**
+     * Returns the number of UTF-16 code units needed to encode the given UTF-32 buffer. Exact if the buffer is valid,
+     * an upper bound otherwise.
+     */
+    std::size_t utf16_length_from_utf32(char32_t const *str, std::size_t length);
+
+    /**
+     * Converts the given UTF-32 buffer to UTF-16. out must have room for utf16_length_from_utf32(str, length) units.
+     */
+    conversion_result convert_utf32_to_utf16(char32_t const *str, std::size_t length, char16_t *out);
+
+    /**
+     * Returns the number of code points in the given UTF-16 buffer. Exact if the buffer is valid, an upper bound
+     * otherwise.
+     */
+    std::size_t utf32_length_from_utf16(char16_t const *str, std::size_t length);
+
+    /**
+     * Converts the given UTF-16 buffer to UTF-32. out must have room for utf32_length_from_utf16(str, length) units.
+     */
+    conversion_result convert_utf16_to_utf32(char16_t const *str, std::size_t length, char32_t *out);
+
+    /**
+     * Returns the number of UTF-16 code units needed to encode the given UTF-8 buffer. Exact if the buffer is valid,
+     * an upper bound otherwise.
+     */
+    std::size_t utf16_length_from_utf8(char const *str, std::size_t length);
+
+    /**
+     * Returns utf16_length_from_utf8(str, length), and sets ascii to whether the buffer only holds ASCII characters,
+     * which the same pass finds.
+     */
+    std::size_t utf16_length_from_utf8(char const *str, std::size_t length, bool &ascii);
+
+    /**
+     * Converts the given UTF-8 buffer to UTF-16. out must have room for utf16_length_from_utf8(str, length) units.
+     */
+    conversion_result convert_utf8_to_utf16(char const *str, std::size_t length, char16_t *out);
+
+    /**
+     * Returns the number of bytes needed to encode the given UTF-16 buffer in UTF-8. Exact if the buffer is valid, an
+     * upper bound otherwise.
+     */
+    std::size_t utf8_length_from_utf16(char16_t const *str, std::size_t length);
+
+    /**
+     * Converts the given UTF-16 buffer to UTF-8. out must have room for utf8_length_from_utf16(str, length) bytes.
+     */
+    conversion_result convert_utf16_to_utf8(char16_t const *str, std::size_t length, char *out);
+
+    /**
+     * Returns the number of bytes needed to encode the given UTF-32 buffer in UTF-8. Exact if the buffer is valid, an
+     * upper bound otherwise.
+     */
+    std::size_t utf8_length_from_utf32(char32_t const *str, std::size_t length);
+
+    /**
+     * Converts the given UTF-32 buffer to UTF-8. out must have room for utf8_length_from_utf32(str, length) bytes.
+     */
+    conversion_result convert_utf32_to_utf8(char32_t const *str, std::size_t length, char *out);
+
+    /**
+     * Returns the number of code points in the given UTF-8 buffer. Exact if the buffer is valid, an upper bound
+     * otherwise.
+     */
+    std::size_t utf32_length_from_utf8(char const *str, std::size_t length);
+
+    /**
+     * Returns utf32_length_from_utf8(str, length), and sets ascii to whether the buffer only holds ASCII characters,
+     * which the same pass finds.
+     */
+    std::size_t utf32_length_from_utf8(char const *str, std::size_t length, bool &ascii);
+
+    /**
+     * Converts the given UTF-8 buffer to UTF-32. out must have room for utf32_length_from_utf8(str, length) units.
+     */
+    conversion_result convert_utf8_to_utf32(char const *str, std::size_t length, char32_t *out);
+
+    /**
+     * Returns whether the given buffer only holds ASCII characters.
+     */
+    bool is_ascii(char const *str, std::size_t length);
+    bool is_ascii(char16_t const *str, std::size_t length);
+    bool is_ascii(char32_t const *str, std::size_t length);
+
+    /**
+     * Single-byte encodings. Windows-1252 only differs from Latin-1 (ISO-8859-1) in the bytes 0x80 to 0x9F.
+     */
+    enum class legacy_encoding { latin1, windows1252 };
+
+    /**
+     * Returns the number of bytes needed to encode the given legacy buffer in UTF-8.
+     */
+    std::size_t utf8_length_from_legacy(legacy_encoding encoding, char const *str, std::size_t length);
+
+    /**
+     * Converts the given legacy buffer to UTF-8 and returns the number of bytes written. out must have room for
+     * utf8_length_from_legacy(encoding, str, length) bytes.
+     */
+    std::size_t convert_legacy_to_utf8(legacy_encoding encoding, char const *str, std::size_t length, char *out);
+
+    /**
+     * Converts the given legacy buffer to UTF-16 or UTF-32, one unit per byte. out must have room for length units.
+     */
+    void convert_legacy_to_utf16(legacy_encoding encoding, char const *str, std::size_t length, char16_t *out);
+    void convert_legacy_to_utf32(legacy_encoding encoding, char const *str, std::size_t length, char32_t *out);
+
+    /**
+     * Converts the given buffer to a legacy encoding, one byte per code point. out must have room for length bytes.
+     * The conversion also stops at the first code point the encoding lacks.
+     */
+    conversion_result convert_utf8_to_legacy(legacy_encoding encoding, char const *str, std::size_t length, char *out);
+    conversion_result convert_utf16_to_legacy(legacy_encoding encoding, char16_t const *str, std::size_t length, char *out);
+    conversion_result convert_utf32_to_legacy(legacy_encoding encoding, char32_t const *str, std::size_t length, char *out);
+
+    /**
+     * Returns the position of the code point that follows the first count ones of the given buffer, which must start
+     * with a code point, or length if the buffer holds fewer. The code points are told apart without being decoded.
+     */
+    std::size_t advance_utf8(char const *str, std::size_t length, std::size_t count);
+    std::size_t advance_utf16(char16_t const *str, std::size_t length, std::size_t count);
+
+    /**
+     * Returns the length of the longest prefix of the given buffer whose units are all less than bound, which must not
+     * be 0. The code points below a given one are so skipped without being decoded, in UTF-8 up to a lead byte.
+     */
+    std::size_t length_below(char const *str, std::size_t length, unsigned char bound);
+    std::size_t length_below(char16_t const *str, std::size_t length, char16_t bound);
+    std::size_t length_below(char32_t const *str, std::size_t length, char32_t bound);
+}
+
+#endif /* unistring_kernels_hpp */
@@ -0,0 +1,1083 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  unistring_normalizer.cpp
+//
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "unistring_normalizer.h"
+#include "unistring_kernels.h"
+#include "basic_unistring.h"
+
+namespace {
+    /*
+     * Quick-check data of a normalization form: the offset of its values in the result of utf8proc_quick_check, the
+     * first code point it may alter, and whether it case folds. The code points below the bound also have a combining
+     * class of 0; the bound of a case folding form leaves out the uppercase ASCII letters, which are searched apart.
+     */
+    struct quick_check_form {
+        int shift;
+        char32_t bound;
+        bool casefold;
+    };
+
+    quick_check_form quick_check_data(unistring_normalization_form form) {
+        switch(form) {
+            case unistring_normalization_form::nfc:
+                return {UTF8PROC_QC_NFC_SHIFT, 0x300, false};
+            case unistring_normalization_form::nfd:
+                return {UTF8PROC_QC_NFD_SHIFT, 0xC0, false};
+            case unistring_normalization_form::nfkc:
+                return {UTF8PROC_QC_NFKC_SHIFT, 0xA0, false};
+            case unistring_normalization_form::nfkd:
+                return {UTF8PROC_QC_NFKD_SHIFT, 0xA0, false};
+            case unistring_normalization_form::nfkc_casefold:
+                return {UTF8PROC_QC_NFKC_SHIFT, 0xA0, true};
+        }
+
+        return {UTF8PROC_QC_NFC_SHIFT, 0x300, false};
+    }
+
+    /*
+     * Unit below which every unit stands for a code point below the given one. In UTF-8, that is the lead byte of the
+     * code point, which must take at most 2 bytes.
+     */
+    unsigned char unit_bound(char const *, char32_t bound) {
+        return static_cast<unsigned char>(bound < 0x80 ? bound : 0xC0 | (bound >> 6));
+    }
+
+    char16_t unit_bound(char16_t const *, char32_t bound) {
+        return static_cast<char16_t>(bound);
+    }
+
+    char32_t unit_bound(char32_t const *, char32_t bound) {
+        return bound;
+    }
+
+    /*
+     * Quick-check value of a code point for case folding: no for the uppercase ASCII letters and the ignorable code
+     * points, maybe for the other code points that fold, which NFKC may compose back as with U+0390.
+     */
+    unsigned casefold_value(char32_t codepoint) {
+        if(codepoint < 0x80) {
+            return codepoint < 'A' || codepoint > 'Z' ? UTF8PROC_QC_YES : UTF8PROC_QC_NO;
+        }
+        utf8proc_property_t const *property = utf8proc_get_property(codepoint);
+        if(property->ignorable) {
+            return UTF8PROC_QC_NO;
+        }
+
+        return property->casefold_mapping == nullptr ? UTF8PROC_QC_YES : UTF8PROC_QC_MAYBE;
+    }
+
+    /*
+     * Quick-check value of a code point of the given data for a form.
+     */
+    unsigned quick_check_value(char32_t codepoint, unsigned properties, quick_check_form const &data) {
+        unsigned const value = (properties >> data.shift) & 3;
+        if(!data.casefold || value == UTF8PROC_QC_NO) {
+            return value;
+        }
+        unsigned const casefold = casefold_value(codepoint);
+
+        return casefold == UTF8PROC_QC_NO ? casefold : value | casefold;
+    }
+
+    /*
+     * Length of the run of units below the bound at the beginning of the given buffer, which for a case folding form
+     * ends at the first uppercase ASCII letter. The letters are then searched by chunks, not to scan the rest of the
+     * buffer at each of them.
+     */
+    template <typename CharType>
+    std::size_t run_length(CharType const *str, std::size_t length, quick_check_form const &data) {
+        auto const bound = unit_bound(str, data.bound);
+        if(!data.casefold) {
+            return unistring_kernels::length_below(str, length, bound);
+        }
+
+        constexpr std::size_t chunk_length = 256;
+        for(std::size_t run = 0;;) {
+            std::size_t const chunk = std::min(length - run, chunk_length);
+            CharType const *const first = str + run;
+            CharType const *const last =
+                std::find_if(first, first + chunk, [](CharType unit) { return unit >= 'A' && unit <= 'Z'; });
+            std::size_t const lower = unistring_kernels::length_below(first, last - first, bound);
+            run += lower;
+            if(lower != chunk || run == length) {
+                return run;
+            }
+        }
+    }
+
+    /*
+     * Whether a run of units below the bound is well-formed. Only UTF-8 needs to be checked, the bounds being below
+     * the surrogates.
+     */
+    bool well_formed_run(char const *str, std::size_t length) {
+        return unistring_kernels::validate_utf8(str, length);
+    }
+
+    template <typename CharType>
+    bool well_formed_run(CharType const *, std::size_t) {
+        return true;
+    }
+
+    /*
+     * Whether the U+FFFD the code point iterator read between start and end is in the string, rather than standing
+     * for an ill-formed sequence.
+     */
+    bool encodes_replacement(char const *start, char const *end) {
+        return end - start == 3;
+    }
+
+    template <typename CharType>
+    bool encodes_replacement(CharType const *start, CharType const *) {
+        return *start == 0xFFFD;
+    }
+
+    /*
+     * The quick check of UAX#15, which answers no at the first ill-formed sequence.
+     */
+    template <typename CharType>
+    utf8proc_qc_t quick_check_units(CharType const *str, std::size_t length, unistring_normalization_form form) {
+        quick_check_form const data = quick_check_data(form);
+        auto const bound = unit_bound(str, data.bound);
+        CharType const *const last = str + length;
+        unsigned previous_class = 0;
+        utf8proc_qc_t result = UTF8PROC_QC_YES;
+        for(CharType const *pos = str; pos != last;) {
+            std::size_t const run =
+                static_cast<std::make_unsigned_t<CharType>>(*pos) < bound ? run_length(pos, last - pos, data) : 0;
+            if(run > 0) {
+                if(!well_formed_run(pos, run)) {
+                    return UTF8PROC_QC_NO;
+                }
+                pos += run;
+                previous_class = 0;
+                continue;
+            }
+
+            unistring_codepoint_iterator<CharType> next(str, pos, last);
+            char32_t const codepoint = *next;
+            ++next;
+            if(codepoint == 0xFFFD && !encodes_replacement(pos, next.base())) {
+                return UTF8PROC_QC_NO;
+            }
+            unsigned const properties = utf8proc_quick_check(codepoint);
+            unsigned const combining_class = properties >> UTF8PROC_QC_COMBINING_CLASS_SHIFT;
+            unsigned const value = quick_check_value(codepoint, properties, data);
+            if((combining_class != 0 && previous_class > combining_class) || value == UTF8PROC_QC_NO) {
+                return UTF8PROC_QC_NO;
+            } else if(value == UTF8PROC_QC_MAYBE) {
+                result = UTF8PROC_QC_MAYBE;
+            }
+            previous_class = combining_class;
+            pos = next.base();
+        }
+
+        return result;
+    }
+}
+
+utf8proc_qc_t unistring_normalizer::quick_check(char const *str, std::size_t length, unistring_normalization_form form) {
+    return quick_check_units(str, length, form);
+}
+
+utf8proc_qc_t unistring_normalizer::quick_check(char16_t const *str, std::size_t length, unistring_normalization_form form) {
+    return quick_check_units(str, length, form);
+}
+
+utf8proc_qc_t unistring_normalizer::quick_check(char32_t const *str, std::size_t length, unistring_normalization_form form) {
+    return quick_check_units(str, length, form);
+}
+
+namespace {
+    /*
+     * Entries of a segment: a code point in the low bits, and its canonical combining class in the high byte.
+     */
+    constexpr int entry_class_shift = 24;
+
+    std::uint32_t make_entry(char32_t codepoint, unsigned combining_class) {
+        return codepoint | (combining_class << entry_class_shift);
+    }
+
+    char32_t entry_codepoint(std::uint32_t entry) {
+        return entry & ((1u << entry_class_shift) - 1);
+    }
+
+    unsigned entry_class(std::uint32_t entry) {
+        return entry >> entry_class_shift;
+    }
+
+    /*
+     * The decomposed code points since the last segment boundary, in a stack buffer that spills to the heap storage
+     * of the normalizer when a segment outgrows it.
+     */
+    class segment_buffer {
+    public:
+        explicit segment_buffer(std::vector<std::uint32_t> &heap) : heap(heap) {}
+        segment_buffer(segment_buffer const &) = delete;
+        segment_buffer &operator=(segment_buffer const &) = delete;
+
+        void push_back(std::uint32_t entry) {
+            if(count == capacity) {
+                this->grow();
+            }
+            entries[count++] = entry;
+        }
+
+        bool empty() const {
+            return count == 0;
+        }
+
+        std::uint32_t *begin() {
+            return entries;
+        }
+        std::uint32_t *end() {
+            return entries + count;
+        }
+
+        void clear() {
+            count = 0;
+        }
+
+    private:
+        void grow() {
+            if(entries == local) {
+                heap.assign(local, local + count);
+            }
+            heap.resize(2 * capacity);
+            entries = heap.data();
+            capacity = heap.size();
+        }
+
+        static constexpr std::size_t local_capacity = 32;
+
+        std::uint32_t local[local_capacity];
+        std::uint32_t *entries = local;
+        std::size_t count = 0;
+        std::size_t capacity = local_capacity;
+        std::vector<std::uint32_t> &heap;
+    };
+
+    /*
+     * Composes a reordered segment in place, as utf8proc_reencode does, and returns its new end. A code point combines
+     * with the last starter unless a code point of a greater or equal combining class stands between them.
+     */
+    std::uint32_t *compose_segment(std::uint32_t *first, std::uint32_t *last) {
+        std::uint32_t *starter = nullptr;
+        int max_class = -1;
+        std::uint32_t *out = first;
+        for(std::uint32_t *it = first; it != last; ++it) {
+            int const combining_class = entry_class(*it);
+            if(starter != nullptr && combining_class > max_class) {
+                utf8proc_int32_t const composite = utf8proc_compose_pair(entry_codepoint(*starter), entry_codepoint(*it));
+                if(composite >= 0) {
+                    *starter = make_entry(composite, 0);
+                    continue;
+                }
+            }
+
+            *out = *it;
+            if(combining_class != 0) {
+                max_class = std::max(max_class, combining_class);
+            } else {
+                starter = out;
+                max_class = -1;
+            }
+            ++out;
+        }
+
+        return out;
+    }
+
+    /*
+     * Encodes a code point at out and returns the end of its units, at most 4 of them.
+     */
+    char *encode_units(char32_t codepoint, char *out) {
+        if(codepoint < 0x80) {
+            *out++ = static_cast<char>(codepoint);
+        } else if(codepoint < 0x800) {
+            *out++ = static_cast<char>(0xC0 | codepoint >> 6);
+            *out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+        } else if(codepoint < 0x10000) {
+            *out++ = static_cast<char>(0xE0 | codepoint >> 12);
+            *out++ = static_cast<char>(0x80 | (codepoint >> 6 & 0x3F));
+            *out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+        } else {
+            *out++ = static_cast<char>(0xF0 | codepoint >> 18);
+            *out++ = static_cast<char>(0x80 | (codepoint >> 12 & 0x3F));
+            *out++ = static_cast<char>(0x80 | (codepoint >> 6 & 0x3F));
+            *out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+
+        return out;
+    }
+
+    char16_t *encode_units(char32_t codepoint, char16_t *out) {
+        if(codepoint < 0x10000) {
+            *out++ = static_cast<char16_t>(codepoint);
+        } else {
+            *out++ = static_cast<char16_t>(0xD7C0 + (codepoint >> 10));
+            *out++ = static_cast<char16_t>(0xDC00 | (codepoint & 0x3FF));
+        }
+
+        return out;
+    }
+
+    char32_t *encode_units(char32_t codepoint, char32_t *out) {
+        *out++ = codepoint;
+        return out;
+    }
+
+    /*
+     * Start of the code point ending at pos, which the code points below a quick-check bound only are.
+     */
+    char const *last_codepoint(char const *pos) {
+        for(--pos; (*pos & 0xC0) == 0x80; --pos) {
+        }
+        return pos;
+    }
+
+    template <typename CharType>
+    CharType const *last_codepoint(CharType const *pos) {
+        return pos - 1;
+    }
+
+    /*
+     * Appends to a string through a cursor. The string is grown ahead, twice as much each time, and only cut to what
+     * was written in the end, so that small appends cost no more than a copy.
+     */
+    template <typename CharType>
+    class output_buffer {
+    public:
+        output_buffer(std::basic_string<CharType> &out, std::size_t expected)
+                : out(out), initial_size(out.size()), size(out.size()) {
+            out.resize(initial_size + expected);
+        }
+        output_buffer(output_buffer const &) = delete;
+        output_buffer &operator=(output_buffer const &) = delete;
+
+        /*
+         * Returns where to write up to count more units, which commit then keeps.
+         */
+        CharType *reserve(std::size_t count) {
+            if(out.size() - size < count) {
+                out.resize(std::max(2 * out.size(), size + count));
+            }
+            return &out[size];
+        }
+        void commit(CharType const *end) {
+            size = end - &out[0];
+        }
+
+        void append(CharType const *first, CharType const *last) {
+            CharType *const pos = this->reserve(last - first);
+            this->commit(std::copy(first, last, pos));
+        }
+
+        void finish() {
+            out.resize(size);
+        }
+        void discard() {
+            out.resize(initial_size);
+        }
+
+    private:
+        std::basic_string<CharType> &out;
+        std::size_t initial_size;
+        std::size_t size;
+    };
+
+    /*
+     * Sorts the non-starters of a segment by combining class, keeping the order of those of the same class, composes
+     * it if the form does and appends it to out.
+     */
+    template <typename CharType>
+    void flush_segment(segment_buffer &segment, bool compose, output_buffer<CharType> &out) {
+        std::uint32_t *const first = segment.begin();
+        std::uint32_t *last = segment.end();
+        for(std::uint32_t *it = first; it != last; ++it) {
+            std::uint32_t const entry = *it;
+            unsigned const combining_class = entry_class(entry);
+            std::uint32_t *slot = it;
+            for(; slot != first && entry_class(slot[-1]) > combining_class && combining_class != 0; --slot) {
+                *slot = slot[-1];
+            }
+            *slot = entry;
+        }
+        if(compose) {
+            last = compose_segment(first, last);
+        }
+        CharType *end = out.reserve(4 * (last - first));
+        for(std::uint32_t *it = first; it != last; ++it) {
+            end = encode_units(entry_codepoint(*it), end);
+        }
+        out.commit(end);
+        segment.clear();
+    }
+
+    /*
+     * Longest full decomposition of a code point, U+FDFA taking 18 in the compatibility forms.
+     */
+    constexpr std::size_t max_decomposition = 32;
+
+    constexpr char32_t hangul_s_base = 0xAC00;
+    constexpr char32_t hangul_l_base = 0x1100;
+    constexpr char32_t hangul_v_base = 0x1161;
+    constexpr char32_t hangul_t_base = 0x11A7;
+    constexpr char32_t hangul_t_count = 28;
+    constexpr char32_t hangul_n_count = 21 * hangul_t_count;
+    constexpr char32_t hangul_s_count = 19 * hangul_n_count;
+
+    /*
+     * What the normalization of a form involves: the utf8proc options of its decomposition, whether it composes, its
+     * quick-check data and the offset of the quick-check values of its decomposition.
+     */
+    struct normalization_steps {
+        utf8proc_option_t options;
+        bool compose;
+        quick_check_form check;
+        int decomposition_shift;
+    };
+
+    normalization_steps steps_of(unistring_normalization_form form) {
+        quick_check_form const check = quick_check_data(form);
+        bool const compose = form != unistring_normalization_form::nfd && form != unistring_normalization_form::nfkd;
+        bool const compat = form != unistring_normalization_form::nfc && form != unistring_normalization_form::nfd;
+        int const options = UTF8PROC_DECOMPOSE | (compat ? UTF8PROC_COMPAT : 0) |
+                            (check.casefold ? UTF8PROC_CASEFOLD | UTF8PROC_IGNORE : 0);
+
+        return {static_cast<utf8proc_option_t>(options), compose, check,
+                compat ? UTF8PROC_QC_NFKD_SHIFT : UTF8PROC_QC_NFD_SHIFT};
+    }
+
+    /*
+     * Whether nothing before a code point of the given quick-check data can combine with it or be reordered around
+     * it, so that a segment starts there.
+     */
+    bool is_boundary(unsigned properties, normalization_steps const &steps) {
+        return (properties >> UTF8PROC_QC_COMBINING_CLASS_SHIFT) == 0 &&
+               (!steps.compose || ((properties >> steps.check.shift) & 3) == UTF8PROC_QC_YES);
+    }
+
+    /*
+     * Normalizes the code points from pos on, segment by segment, up to the first boundary after pos in the input that
+     * passes the quick check. Returns the position of that boundary, or nullptr at an ill-formed sequence.
+     */
+    template <typename CharType>
+    CharType const *normalize_segments(CharType const *first, CharType const *pos, CharType const *last,
+                                       normalization_steps const &steps, std::vector<std::uint32_t> &long_segment,
+                                       output_buffer<CharType> &out) {
+        segment_buffer segment(long_segment);
+        unistring_codepoint_iterator<CharType> next(first, pos, last);
+        for(CharType const *start = pos; pos != last;) {
+            char32_t const codepoint = *next;
+            ++next;
+            if(codepoint == 0xFFFD && !encodes_replacement(pos, next.base())) {
+                return nullptr;
+            }
+            unsigned properties = utf8proc_quick_check(codepoint);
+            bool const keeps = quick_check_value(codepoint, properties, steps.check) == UTF8PROC_QC_YES;
+            // Only stop where the input can be copied as is again
+            bool boundary = keeps && is_boundary(properties, steps);
+
+            utf8proc_int32_t decomposition[max_decomposition];
+            utf8proc_ssize_t count = 1;
+            if(((properties >> steps.decomposition_shift) & 3) == UTF8PROC_QC_YES &&
+               (!steps.check.casefold || casefold_value(codepoint) == UTF8PROC_QC_YES)) {
+                decomposition[0] = codepoint;
+            } else if(codepoint < 0x80) {
+                // An uppercase ASCII letter, as only a case folding form leaves no other ASCII code point as is
+                decomposition[0] = codepoint + ('a' - 'A');
+            } else if(codepoint - hangul_s_base < hangul_s_count) {
+                // Hangul syllables decompose algorithmically into a leading and a vowel jamo, and a trailing one or not
+                char32_t const index = codepoint - hangul_s_base;
+                decomposition[0] = hangul_l_base + index / hangul_n_count;
+                decomposition[1] = hangul_v_base + index % hangul_n_count / hangul_t_count;
+                decomposition[2] = hangul_t_base + index % hangul_t_count;
+                count = decomposition[2] != hangul_t_base ? 3 : 2;
+                properties = utf8proc_quick_check(decomposition[0]);
+            } else {
+                int boundclass = UTF8PROC_BOUNDCLASS_START;
+                count = utf8proc_decompose_char(codepoint, decomposition, max_decomposition, steps.options, &boundclass);
+                if(count < 0 || count > static_cast<utf8proc_ssize_t>(max_decomposition)) {
+                    return nullptr;
+                } else if(count > 0) {
+                    properties = utf8proc_quick_check(decomposition[0]);
+                    // A starter whose decomposition starts with a non-starter, such as U+0F73, is no boundary
+                    boundary = boundary && (properties >> UTF8PROC_QC_COMBINING_CLASS_SHIFT) == 0;
+                }
+            }
+            if(boundary && pos != start) {
+                break;
+            }
+            pos = next.base();
+
+            for(utf8proc_ssize_t i = 0; i < count; ++i) {
+                if(i > 0) {
+                    properties = utf8proc_quick_check(decomposition[i]);
+                }
+                if(is_boundary(properties, steps) && !segment.empty()) {
+                    flush_segment(segment, steps.compose, out);
+                }
+                segment.push_back(make_entry(decomposition[i], properties >> UTF8PROC_QC_COMBINING_CLASS_SHIFT));
+            }
+        }
+        flush_segment(segment, steps.compose, out);
+
+        return pos;
+    }
+
+    /*
+     * The input is first quick-checked, and copied as is while it passes. Only from the last boundary before a code
+     * point that fails is it normalized, until the next boundary.
+     */
+    template <typename CharType>
+    bool normalize_units(CharType const *str, std::size_t length, unistring_normalization_form form,
+                         std::vector<std::uint32_t> &long_segment, std::basic_string<CharType> &out) {
+        normalization_steps const steps = steps_of(form);
+
+        output_buffer<CharType> buffer(out, length);
+        CharType const *const last = str + length;
+        CharType const *verbatim = str;
+        CharType const *boundary = str;
+        unsigned previous_class = 0;
+        unistring_codepoint_iterator<CharType> next(str, str, last);
+        auto const bound = unit_bound(str, steps.check.bound);
+        for(CharType const *pos = str; pos != last;) {
+            std::size_t const run =
+                static_cast<std::make_unsigned_t<CharType>>(*pos) < bound ? run_length(pos, last - pos, steps.check) : 0;
+            if(run > 0) {
+                if(!well_formed_run(pos, run)) {
+                    buffer.discard();
+                    return false;
+                }
+                pos += run;
+                boundary = last_codepoint(pos);
+                previous_class = 0;
+                next = unistring_codepoint_iterator<CharType>(str, pos, last);
+                continue;
+            }
+
+            char32_t const codepoint = *next;
+            ++next;
+            if(codepoint == 0xFFFD && !encodes_replacement(pos, next.base())) {
+                buffer.discard();
+                return false;
+            }
+            if(steps.check.casefold && codepoint >= 'A' && codepoint <= 'Z' &&
+               (next.base() == last || static_cast<std::make_unsigned_t<CharType>>(*next.base()) < 0x80)) {
+                // An uppercase ASCII letter followed by an ASCII code point folds on its own, both being boundaries
+                CharType const lowercase = static_cast<CharType>(codepoint + ('a' - 'A'));
+                buffer.append(verbatim, pos);
+                buffer.append(&lowercase, &lowercase + 1);
+                verbatim = boundary = pos = next.base();
+                previous_class = 0;
+                continue;
+            }
+            unsigned const properties = utf8proc_quick_check(codepoint);
+            unsigned const combining_class = properties >> UTF8PROC_QC_COMBINING_CLASS_SHIFT;
+            if(quick_check_value(codepoint, properties, steps.check) == UTF8PROC_QC_YES &&
+               (combining_class == 0 || previous_class <= combining_class)) {
+                if(combining_class == 0) {
+                    boundary = pos;
+                }
+                previous_class = combining_class;
+                pos = next.base();
+                continue;
+            }
+
+            buffer.append(verbatim, boundary);
+            pos = normalize_segments(str, boundary, last, steps, long_segment, buffer);
+            if(pos == nullptr) {
+                buffer.discard();
+                return false;
+            }
+            verbatim = boundary = pos;
+            previous_class = 0;
+            next = unistring_codepoint_iterator<CharType>(str, pos, last);
+        }
+        buffer.append(verbatim, last);
+        buffer.finish();
+
+        return true;
+    }
+}
+
+unistring_normalizer &unistring_normalizer::of_thread(unistring_normalization_form form) {
+    using form_type = unistring_normalization_form;
+    thread_local unistring_normalizer normalizers[] = {
+        unistring_normalizer(form_type::nfc), unistring_normalizer(form_type::nfd), unistring_normalizer(form_type::nfkc),
+        unistring_normalizer(form_type::nfkd), unistring_normalizer(form_type::nfkc_casefold)};
+
+    return normalizers[static_cast<int>(form)];
+}
+
+bool unistring_normalizer::normalize(char const *str, std::size_t length, std::string &out) {
+    return normalize_units(str, length, normalization_form, long_segment, out);
+}
+
+bool unistring_normalizer::normalize(char16_t const *str, std::size_t length, std::u16string &out) {
+    return normalize_units(str, length, normalization_form, long_segment, out);
+}
+
+bool unistring_normalizer::normalize(char32_t const *str, std::size_t length, std::u32string &out) {
+    return normalize_units(str, length, normalization_form, long_segment, out);
+}
+
+namespace {
+    /*
+     * Shortest chunk, in units, a buffer is cut into for parallel normalization.
+     */
+    constexpr std::size_t parallel_chunk_length = std::size_t(1) << 16;
+
+    /*
+     * Whether the code point is stable, a starter that passes the quick check, which nothing before can combine with
+     * or be reordered past. U+FFFD is not, as it stands for ill-formed units.
+     */
+    bool is_stable(char32_t codepoint, quick_check_form const &data) {
+        unsigned const properties = utf8proc_quick_check(codepoint);
+        return codepoint != 0xFFFD && (properties >> UTF8PROC_QC_COMBINING_CLASS_SHIFT) == 0 &&
+               quick_check_value(codepoint, properties, data) == UTF8PROC_QC_YES;
+    }
+
+    /*
+     * Position of the first stable code point of [pos, last), or last if there is none. The scan may start within a
+     * sequence, whose units read as U+FFFD and are skipped.
+     */
+    template <typename CharType>
+    CharType const *stable_codepoint(CharType const *first, CharType const *pos, CharType const *last,
+                                     quick_check_form const &data) {
+        for(unistring_codepoint_iterator<CharType> it(first, pos, last); it.base() != last; ++it) {
+            if(is_stable(*it, data)) {
+                return it.base();
+            }
+        }
+
+        return last;
+    }
+
+    class helped_task;
+
+    /*
+     * Threads that help with the parallel normalizations, started as more are needed and kept for the next ones. The
+     * pool is never destroyed, so that its idle threads can wait for work until the process exits.
+     */
+    struct helper_pool {
+        std::mutex mutex;
+        std::condition_variable work_available;
+        std::deque<helped_task *> queue;
+        unsigned threads = 0;
+
+        static helper_pool &instance() {
+            static helper_pool *const pool = new helper_pool;
+            return *pool;
+        }
+    };
+
+    /*
+     * Task that up to the given number of threads of the pool run alongside the calling thread, as they get to it.
+     * The destructor withdraws the requests no thread has taken yet and waits for the threads running the task, so
+     * that the calling thread, which must run the task itself as well, never depends on a thread being available. A
+     * thread the pool fails to start leaves one helper less.
+     */
+    class helped_task {
+    public:
+        helped_task(unsigned helpers, std::function<void()> task) : task(std::move(task)) {
+            helper_pool &pool = helper_pool::instance();
+            {
+                std::lock_guard<std::mutex> lock(pool.mutex);
+                for(; pool.threads < helpers; ++pool.threads) {
+                    try {
+                        std::thread(&helped_task::serve).detach();
+                    } catch(std::system_error const &) {
+                        break;
+                    }
+                }
+                pending = std::min(helpers, pool.threads);
+                if(pending > 0) {
+                    pool.queue.push_back(this);
+                }
+            }
+            pool.work_available.notify_all();
+        }
+        helped_task(helped_task const &) = delete;
+        helped_task &operator=(helped_task const &) = delete;
+
+        ~helped_task() {
+            helper_pool &pool = helper_pool::instance();
+            std::unique_lock<std::mutex> lock(pool.mutex);
+            if(pending > 0) {
+                pool.queue.erase(std::find(pool.queue.begin(), pool.queue.end(), this));
+                pending = 0;
+            }
+            done.wait(lock, [this] { return running == 0; });
+        }
+
+    private:
+        static void serve() {
+            helper_pool &pool = helper_pool::instance();
+            std::unique_lock<std::mutex> lock(pool.mutex);
+            for(;;) {
+                pool.work_available.wait(lock, [&pool] { return !pool.queue.empty(); });
+                helped_task &helped = *pool.queue.front();
+                if(--helped.pending == 0) {
+                    pool.queue.pop_front();
+                }
+                ++helped.running;
+                lock.unlock();
+                helped.task();
+                lock.lock();
+                if(--helped.running == 0) {
+                    helped.done.notify_all();
+                }
+            }
+        }
+
+        std::function<void()> task;
+        unsigned pending = 0;
+        unsigned running = 0;
+        std::condition_variable done;
+    };
+
+    /*
+     * Normalizes the chunks of the buffer between consecutive cuts on up to threads threads, the calling one and
+     * threads of the pool, which take the next chunk as they are done with the previous one.
+     */
+    template <typename CharType>
+    bool normalize_chunks(std::vector<CharType const *> const &cuts, unistring_normalizer &normalizer, unsigned threads,
+                          std::vector<std::basic_string<CharType>> &chunks) {
+        std::size_t const count = cuts.size() - 1;
+        std::atomic<std::size_t> next_chunk(0);
+        std::atomic<bool> failed(false);
+        std::mutex error_mutex;
+        std::exception_ptr error;
+        auto const work = [&](unistring_normalizer &worker) {
+            try {
+                for(std::size_t i = next_chunk++; i < count && !failed; i = next_chunk++) {
+                    if(!worker.normalize(cuts[i], cuts[i + 1] - cuts[i], chunks[i])) {
+                        failed = true;
+                    }
+                }
+            } catch(...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if(!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        };
+
+        {
+            helped_task const helped(threads - 1, [&]() { work(unistring_normalizer::of_thread(normalizer.form())); });
+            work(normalizer);
+        }
+        if(error) {
+            std::rethrow_exception(error);
+        }
+
+        return !failed;
+    }
+
+    template <typename CharType>
+    bool normalize_parallel_units(CharType const *str, std::size_t length, unistring_normalizer &normalizer,
+                                  unsigned threads, std::basic_string<CharType> &out) {
+        if(threads == 0) {
+            threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        std::size_t const chunk_count = std::min<std::size_t>(4 * threads, length / parallel_chunk_length);
+        if(threads == 1 || chunk_count < 2) {
+            return normalizer.normalize(str, length, out);
+        }
+
+        // Each cut is the first stable code point after an even share of the buffer, provided one comes before the next
+        quick_check_form const data = quick_check_data(normalizer.form());
+        CharType const *const last = str + length;
+        std::vector<CharType const *> cuts{str};
+        for(std::size_t i = 1; i < chunk_count; ++i) {
+            CharType const *const share = std::max(str + length / chunk_count * i, cuts.back() + 1);
+            CharType const *const next_share = str + length / chunk_count * (i + 1);
+            CharType const *const cut = share < next_share ? stable_codepoint(str, share, next_share, data) : next_share;
+            if(cut != next_share) {
+                cuts.push_back(cut);
+            }
+        }
+        cuts.push_back(last);
+
+        std::vector<std::basic_string<CharType>> chunks(cuts.size() - 1);
+        threads = static_cast<unsigned>(std::min<std::size_t>(threads, chunks.size()));
+        if(!normalize_chunks(cuts, normalizer, threads, chunks)) {
+            return false;
+        }
+        std::size_t total = out.size();
+        for(std::basic_string<CharType> const &chunk : chunks) {
+            total += chunk.size();
+        }
+        out.reserve(total);
+        for(std::basic_string<CharType> &chunk : chunks) {
+            out += chunk;
+            std::basic_string<CharType>().swap(chunk);
+        }
+
+        return true;
+    }
+}
+
+bool unistring_normalizer::normalize_parallel(char const *str, std::size_t length, std::string &out, unsigned threads) {
+    return normalize_parallel_units(str, length, *this, threads, out);
+}
+
+bool unistring_normalizer::normalize_parallel(char16_t const *str, std::size_t length, std::u16string &out,
+                                              unsigned threads) {
+    return normalize_parallel_units(str, length, *this, threads, out);
+}
+
+bool unistring_normalizer::normalize_parallel(char32_t const *str, std::size_t length, std::u32string &out,
+                                              unsigned threads) {
+    return normalize_parallel_units(str, length, *this, threads, out);
+}
+
+namespace {
+    template <typename CharType>
+    bool has_boundary_before_units(CharType const *str, std::size_t length, unistring_normalization_form form) {
+        return length == 0 || is_stable(*unistring_codepoint_iterator<CharType>(str, str, str + length),
+                                        quick_check_data(form));
+    }
+
+    template <typename CharType>
+    std::size_t last_boundary_units(CharType const *str, std::size_t length, unistring_normalization_form form) {
+        quick_check_form const data = quick_check_data(form);
+        unistring_codepoint_iterator<CharType> it(str, str + length, str + length);
+        while(it.base() != str) {
+            --it;
+            if(is_stable(*it, data)) {
+                return it.base() - str;
+            }
+        }
+
+        return 0;
+    }
+}
+
+bool unistring_normalizer::has_boundary_before(char const *str, std::size_t length, unistring_normalization_form form) {
+    return has_boundary_before_units(str, length, form);
+}
+
+bool unistring_normalizer::has_boundary_before(char16_t const *str, std::size_t length,
+                                               unistring_normalization_form form) {
+    return has_boundary_before_units(str, length, form);
+}
+
+bool unistring_normalizer::has_boundary_before(char32_t const *str, std::size_t length,
+                                               unistring_normalization_form form) {
+    return has_boundary_before_units(str, length, form);
+}
+
+std::size_t unistring_normalizer::last_boundary(char const *str, std::size_t length, unistring_normalization_form form) {
+    return last_boundary_units(str, length, form);
+}
+
+std::size_t unistring_normalizer::last_boundary(char16_t const *str, std::size_t length,
+                                                unistring_normalization_form form) {
+    return last_boundary_units(str, length, form);
+}
+
+std::size_t unistring_normalizer::last_boundary(char32_t const *str, std::size_t length,
+                                                unistring_normalization_form form) {
+    return last_boundary_units(str, length, form);
+}
+
+/*
+ * A shard maps the cached strings to their normalization and a flag set when they are hit. The map is keyed on views of
+ * the strings held by its entries, so that lookups need not copy the buffer they are given. The clock ring points to
+ * the entries in the order they were inserted, the hand to the next candidate for eviction.
+ */
+template <typename CharType>
+struct unistring_normalization_cache<CharType>::shard {
+    struct cached {
+        string_type key;
+        string_type normalized;
+        bool referenced;
+    };
+
+    /*
+     * Buffer a lookup is given, or key of an entry, hashed with FNV-1a over its units.
+     */
+    struct view_type {
+        CharType const *str;
+        std::size_t length;
+
+        bool operator==(view_type const &other) const {
+            return length == other.length && std::equal(str, str + length, other.str);
+        }
+    };
+    struct view_hash {
+        std::size_t operator()(view_type const &view) const {
+            std::uint64_t hash = 0xCBF29CE484222325;
+            for(std::size_t i = 0; i < view.length; ++i) {
+                hash = (hash ^ static_cast<std::make_unsigned_t<CharType>>(view.str[i])) * 0x100000001B3;
+            }
+            return static_cast<std::size_t>(hash);
+        }
+    };
+    using map_type = std::unordered_map<view_type, std::unique_ptr<cached>, view_hash>;
+
+    std::mutex mutex;
+    map_type entries;
+    std::vector<cached *> ring;
+    std::size_t hand = 0;
+    std::size_t capacity = 0;
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+
+    /*
+     * Returns the slot of the ring a new entry is to take, evicting the entry there if the ring is full.
+     */
+    std::size_t evict() {
+        if(ring.size() < capacity) {
+            ring.push_back(nullptr);
+            return ring.size() - 1;
+        }
+        while(ring[hand]->referenced) {
+            ring[hand]->referenced = false;
+            hand = (hand + 1) % ring.size();
+        }
+        std::size_t const slot = hand;
+        entries.erase(entries.find(view_type{ring[slot]->key.data(), ring[slot]->key.size()}));
+        hand = (hand + 1) % ring.size();
+
+        return slot;
+    }
+};
+
+template <typename CharType>
+unistring_normalization_cache<CharType>::unistring_normalization_cache(std::size_t capacity,
+                                                                       unistring_normalization_form form,
+                                                                       std::size_t shard_count)
+        : normalization_form(form),
+          shard_count(std::max<std::size_t>(std::min(shard_count, capacity), 1)),
+          shards(new shard[this->shard_count]) {
+    // The capacity is spread over the shards, the first ones taking the remainder.
+    capacity = std::max<std::size_t>(capacity, 1);
+    for(std::size_t i = 0; i < this->shard_count; ++i) {
+        shards[i].capacity = capacity / this->shard_count + (i < capacity % this->shard_count ? 1 : 0);
+    }
+}
+
+template <typename CharType>
+unistring_normalization_cache<CharType>::~unistring_normalization_cache() = default;
+
+template <typename CharType>
+bool unistring_normalization_cache<CharType>::normalize(CharType const *str, std::size_t length, string_type &out) {
+    if(unistring_normalizer::quick_check(str, length, normalization_form) == UTF8PROC_QC_YES) {
+        out.append(str, length);
+        return true;
+    }
+
+    typename shard::view_type const key{str, length};
+    shard &owner = shards[typename shard::view_hash()(key) % shard_count];
+    {
+        std::lock_guard<std::mutex> lock(owner.mutex);
+        auto const found = owner.entries.find(key);
+        if(found != owner.entries.end()) {
+            found->second->referenced = true;
+            out += found->second->normalized;
+            ++owner.hits;
+            return true;
+        }
+    }
+    ++owner.misses;
+
+    // Normalized out of the lock; another thread may have cached the same string meanwhile
+    std::unique_ptr<typename shard::cached> entry(new typename shard::cached{string_type(str, length), {}, false});
+    if(!unistring_normalizer::of_thread(normalization_form).normalize(str, length, entry->normalized)) {
+        return false;
+    }
+    out += entry->normalized;
+
+    std::lock_guard<std::mutex> lock(owner.mutex);
+    if(owner.entries.find(key) == owner.entries.end()) {
+        typename shard::cached *const added = entry.get();
+        owner.entries.emplace(typename shard::view_type{added->key.data(), added->key.size()}, std::move(entry));
+        std::size_t const slot = owner.evict();
+        owner.ring[slot] = added;
+    }
+
+    return true;
+}
+
+template <typename CharType>
+std::uint64_t unistring_normalization_cache<CharType>::hits() const {
+    std::uint64_t count = 0;
+    for(std::size_t i = 0; i < shard_count; ++i) {
+        count += shards[i].hits;
+    }
+
+    return count;
+}
+
+template <typename CharType>
+std::uint64_t unistring_normalization_cache<CharType>::misses() const {
+    std::uint64_t count = 0;
+    for(std::size_t i = 0; i < shard_count; ++i) {
+        count += shards[i].misses;
+    }
+
+    return count;
+}
+
+template <typename CharType>
+std::size_t unistring_normalization_cache<CharType>::size() const {
+    std::size_t count = 0;
+    for(std::size_t i = 0; i < shard_count; ++i) {
+        std::lock_guard<std::mutex> lock(shards[i].mutex);
+        count += shards[i].entries.size();
+    }
+
+    return count;
+}
+
+template <typename CharType>
+void unistring_normalization_cache<CharType>::clear() {
+    for(std::size_t i = 0; i < shard_count; ++i) {
+        std::lock_guard<std::mutex> lock(shards[i].mutex);
+        shards[i].entries.clear();
+        shards[i].ring.clear();
+        shards[i].hand = 0;
+    }
+}
+
+template class unistring_normalization_cache<char>;
+template class unistring_normalization_cache<char16_t>;
+template class unistring_normalization_cache<char32_t>;
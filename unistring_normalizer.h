@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  unistring_normalizer.h
+//
+//  Unicode normalization of UTF-8, UTF-16 and UTF-32 buffers, decomposing and composing them in a single pass.
+//
+
+#ifndef unistring_normalizer_hpp
+#define unistring_normalizer_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "utf8proc.h"
+
+/**
+ * Unicode normalization forms (UAX#15). nfkc_casefold is NFKC with full case folding and the default ignorable code
+ * points removed, as utf8proc does it, and suits the comparison of identifiers or search keys.
+ */
+enum class unistring_normalization_form { nfc, nfd, nfkc, nfkd, nfkc_casefold };
+
+/**
+ * Normalizes buffers to a normalization form, as utf8proc_map does with UTF8PROC_STABLE, but in a single pass. The
+ * input is copied as is while it passes the quick check. Around the code points that fail it, the input is cut into
+ * segments at the starters nothing before can combine with, which are decomposed, reordered and composed one at a
+ * time; a segment is held in a small stack buffer, or for unusually long combining sequences in heap storage the
+ * normalizer keeps for the next buffers. Unlike utf8proc_map, it keeps a U+11A7 that follows an LV syllable, as U+11A7
+ * is no trailing jamo.
+ */
+class unistring_normalizer {
+public:
+    explicit unistring_normalizer(unistring_normalization_form form = unistring_normalization_form::nfc)
+            : normalization_form(form) {}
+
+    unistring_normalization_form form() const {
+        return normalization_form;
+    }
+
+    /**
+     * Returns the normalizer of the calling thread for the given form, which keeps its storage from one buffer to the
+     * next.
+     */
+    static unistring_normalizer &of_thread(unistring_normalization_form form);
+
+    /**
+     * Appends the normalization of the given UTF-8, UTF-16 or UTF-32 buffer to out, in the same encoding. Returns
+     * false, leaving out as it was, if the buffer is ill-formed.
+     */
+    bool normalize(char const *str, std::size_t length, std::string &out);
+    bool normalize(char16_t const *str, std::size_t length, std::u16string &out);
+    bool normalize(char32_t const *str, std::size_t length, std::u32string &out);
+
+    /**
+     * Same as normalize, on the given number of threads, the hardware concurrency by default. The buffer is cut at
+     * stable code points, the starters that pass the quick check and so end what comes before them, into chunks that
+     * are normalized apart and then concatenated; the output is that of normalize. The calling thread is helped by
+     * threads of a pool shared by all normalizers, started on first need and kept for the next calls; those busy
+     * with other calls are not waited for. Buffers too short to be worth it are normalized on the calling thread.
+     */
+    bool normalize_parallel(char const *str, std::size_t length, std::string &out, unsigned threads = 0);
+    bool normalize_parallel(char16_t const *str, std::size_t length, std::u16string &out, unsigned threads = 0);
+    bool normalize_parallel(char32_t const *str, std::size_t length, std::u32string &out, unsigned threads = 0);
+
+    /**
+     * The quick check of UAX#15, which tells most normalized buffers apart without normalizing them. Ill-formed
+     * buffers get UTF8PROC_QC_NO.
+     */
+    static utf8proc_qc_t quick_check(char const *str, std::size_t length, unistring_normalization_form form);
+    static utf8proc_qc_t quick_check(char16_t const *str, std::size_t length, unistring_normalization_form form);
+    static utf8proc_qc_t quick_check(char32_t const *str, std::size_t length, unistring_normalization_form form);
+
+    /**
+     * Returns whether the buffer starts with a stable code point, or is empty, so that appending it to a buffer in the
+     * given form yields a buffer in that form as well, provided it is in that form itself.
+     */
+    static bool has_boundary_before(char const *str, std::size_t length, unistring_normalization_form form);
+    static bool has_boundary_before(char16_t const *str, std::size_t length, unistring_normalization_form form);
+    static bool has_boundary_before(char32_t const *str, std::size_t length, unistring_normalization_form form);
+
+    /**
+     * Returns the position of the last stable code point of the buffer, 0 if it has none: what follows it can be
+     * normalized apart from what precedes it.
+     */
+    static std::size_t last_boundary(char const *str, std::size_t length, unistring_normalization_form form);
+    static std::size_t last_boundary(char16_t const *str, std::size_t length, unistring_normalization_form form);
+    static std::size_t last_boundary(char32_t const *str, std::size_t length, unistring_normalization_form form);
+
+private:
+    unistring_normalization_form normalization_form;
+    std::vector<std::uint32_t> long_segment;
+};
+
+/**
+ * Bounded cache of the normalizations of UTF-8, UTF-16 or UTF-32 strings to a form, for workloads that normalize the
+ * same strings over and over. It is split into shards, each behind its own lock, which the strings are spread over by
+ * hash; a full shard evicts with the CLOCK algorithm, a second chance being given to the entries hit since the hand
+ * last passed them. The strings the quick check finds normalized are returned as is without going through the cache.
+ * Safe to use from several threads.
+ */
+template <typename CharType>
+class unistring_normalization_cache {
+public:
+    using string_type = std::basic_string<CharType>;
+
+    /**
+     * Creates a cache of up to capacity entries, at least one, split into the given number of shards, or into
+     * capacity shards if it is less.
+     */
+    explicit unistring_normalization_cache(std::size_t capacity,
+                                           unistring_normalization_form form = unistring_normalization_form::nfc,
+                                           std::size_t shard_count = 16);
+    ~unistring_normalization_cache();
+    unistring_normalization_cache(unistring_normalization_cache const &) = delete;
+    unistring_normalization_cache &operator=(unistring_normalization_cache const &) = delete;
+
+    unistring_normalization_form form() const {
+        return normalization_form;
+    }
+
+    /**
+     * Appends the normalization of the given buffer to out, from the cache if it holds it. Returns false, leaving out
+     * as it was, if the buffer is ill-formed.
+     */
+    bool normalize(CharType const *str, std::size_t length, string_type &out);
+
+    /**
+     * Returns the number of lookups the cache answered and of those it did not, over its lifetime.
+     */
+    std::uint64_t hits() const;
+    std::uint64_t misses() const;
+
+    /**
+     * Returns the number of cached entries.
+     */
+    std::size_t size() const;
+
+    /**
+     * Removes every entry, keeping the counters.
+     */
+    void clear();
+
+private:
+    struct shard;
+
+    unistring_normalization_form normalization_form;
+    std::size_t shard_count;
+    std::unique_ptr<shard[]> shards;
+};
+
+#endif /* unistring_normalizer_hpp */
@@ -264,6 +264,42 @@ UTF8PROC_DLLEXPORT utf8proc_bool utf8proc_grapheme_break(utf8proc_int32_t c1, ut
                         utf8proc_get_property(c2)->boundclass);
 }
 
+UTF8PROC_DLLEXPORT utf8proc_uint16_t utf8proc_quick_check(utf8proc_int32_t uc) {
+  if (uc < 0 || uc >= 0x110000) return 0;
+  return utf8proc_qc_stage2table[utf8proc_qc_stage1table[uc >> 8] + (uc & 0xFF)];
+}
+
+UTF8PROC_DLLEXPORT utf8proc_int32_t utf8proc_compose_pair(utf8proc_int32_t starter, utf8proc_int32_t uc) {
+  const utf8proc_property_t *starter_property, *property;
+  utf8proc_int32_t hangul_lindex, hangul_sindex, composition;
+  if (starter < 0 || starter >= 0x110000 || uc < 0 || uc >= 0x110000) return -1;
+  hangul_lindex = starter - UTF8PROC_HANGUL_LBASE;
+  if (hangul_lindex >= 0 && hangul_lindex < UTF8PROC_HANGUL_LCOUNT) {
+    utf8proc_int32_t hangul_vindex = uc - UTF8PROC_HANGUL_VBASE;
+    if (hangul_vindex >= 0 && hangul_vindex < UTF8PROC_HANGUL_VCOUNT) {
+      return UTF8PROC_HANGUL_SBASE +
+        (hangul_lindex * UTF8PROC_HANGUL_VCOUNT + hangul_vindex) *
+        UTF8PROC_HANGUL_TCOUNT;
+    }
+  }
+  hangul_sindex = starter - UTF8PROC_HANGUL_SBASE;
+  if (hangul_sindex >= 0 && hangul_sindex < UTF8PROC_HANGUL_SCOUNT &&
+      (hangul_sindex % UTF8PROC_HANGUL_TCOUNT) == 0) {
+    utf8proc_int32_t hangul_tindex = uc - UTF8PROC_HANGUL_TBASE;
+    if (hangul_tindex > 0 && hangul_tindex < UTF8PROC_HANGUL_TCOUNT) {
+      return starter + hangul_tindex;
+    }
+  }
+  starter_property = unsafe_get_property(starter);
+  property = unsafe_get_property(uc);
+  if (starter_property->comb1st_index < 0 || property->comb2nd_index < 0) return -1;
+  composition = utf8proc_combinations[
+    starter_property->comb1st_index + property->comb2nd_index
+  ];
+  if (composition < 0 || unsafe_get_property(composition)->comp_exclusion) return -1;
+  return composition;
+}
+
 UTF8PROC_DLLEXPORT utf8proc_int32_t utf8proc_tolower(utf8proc_int32_t c)
 {
   utf8proc_int32_t cl = utf8proc_get_property(c)->lowercase_mapping;
@@ -361,6 +361,25 @@ typedef enum {
   UTF8PROC_BOUNDCLASS_SPACINGMARK        = 12, /**< Spacingmark */
 } utf8proc_boundclass_t;
 
+/** Normalization quick-check values (see UAX#15). */
+typedef enum {
+  UTF8PROC_QC_YES   = 0, /**< May occur in the normalization form, in any context */
+  UTF8PROC_QC_NO    = 1, /**< Never occurs in the normalization form */
+  UTF8PROC_QC_MAYBE = 2, /**< May occur in the normalization form, depending on the preceding codepoints */
+} utf8proc_qc_t;
+
+/**
+ * Offsets of the quick-check value of each normalization form, and of the
+ * canonical combining class, in the result of @ref utf8proc_quick_check.
+ */
+typedef enum {
+  UTF8PROC_QC_NFD_SHIFT             = 0,
+  UTF8PROC_QC_NFC_SHIFT             = 2,
+  UTF8PROC_QC_NFKD_SHIFT            = 4,
+  UTF8PROC_QC_NFKC_SHIFT            = 6,
+  UTF8PROC_QC_COMBINING_CLASS_SHIFT = 8,
+} utf8proc_qc_shift_t;
+
 /**
  * Array containing the byte lengths of a UTF-8 encoded codepoint based
  * on the first byte.
@@ -511,6 +530,21 @@ UTF8PROC_DLLEXPORT utf8proc_ssize_t utf8proc_reencode(utf8proc_int32_t *buffer,
  */
 UTF8PROC_DLLEXPORT utf8proc_bool utf8proc_grapheme_break(utf8proc_int32_t codepoint1, utf8proc_int32_t codepoint2);
 
+/**
+ * Returns the data needed to check whether a string is normalized without
+ * normalizing it: the @ref utf8proc_qc_t value of the codepoint for each
+ * normalization form, on 2 bits, and its canonical combining class, at the
+ * offsets given by @ref utf8proc_qc_shift_t. Invalid codepoints read as 0.
+ */
+UTF8PROC_DLLEXPORT utf8proc_uint16_t utf8proc_quick_check(utf8proc_int32_t codepoint);
+
+/**
+ * Returns the primary composite of a starter and the codepoint that follows
+ * it without being blocked, or -1 if they do not compose. Composites excluded
+ * from composition are not returned, as with @ref UTF8PROC_STABLE.
+ */
+UTF8PROC_DLLEXPORT utf8proc_int32_t utf8proc_compose_pair(utf8proc_int32_t starter, utf8proc_int32_t codepoint);
+
 
 /**
  * Given a codepoint `c`, return the codepoint of the corresponding
@@ -16756,3 +16756,3209 @@ const utf8proc_int32_t utf8proc_combinations[] = {
   -1, -1, -1, -1, 119230, 119232, -1, -1, 
   -1, };
 
+const utf8proc_uint16_t utf8proc_qc_stage1table[] = {
+  0, 256, 512, 768, 1024, 1280, 1536, 
+  1792, 2048, 2304, 2560, 2816, 3072, 3328, 3584, 
+  3840, 4096, 4352, 4608, 4864, 4608, 4608, 4608, 
+  5120, 5376, 5632, 5888, 6144, 6400, 6656, 6912, 
+  7168, 7424, 7680, 7936, 8192, 8448, 4608, 4608, 
+  4608, 4608, 4608, 8704, 4608, 8960, 9216, 9472, 
+  9728, 9984, 10240, 10496, 10752, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 11008, 
+  11264, 11520, 11776, 12032, 12288, 12544, 12544, 12544, 
+  12544, 12544, 12544, 12544, 12544, 12544, 12544, 12544, 
+  12544, 12544, 12544, 12544, 12544, 12544, 12544, 12544, 
+  12544, 12544, 12544, 12544, 12544, 12544, 12544, 12544, 
+  12544, 12544, 12544, 12544, 12544, 12544, 12544, 12544, 
+  12544, 12544, 12544, 12544, 12544, 12544, 12544, 12544, 
+  12800, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 13056, 13312, 13568, 10752, 13824, 14080, 
+  14336, 4608, 14592, 14848, 15104, 4608, 4608, 4608, 
+  4608, 4608, 4608, 15360, 4608, 4608, 4608, 4608, 
+  4608, 15616, 15872, 16128, 16384, 16640, 16896, 17152, 
+  17408, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 17664, 17920, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 18176, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 18432, 18688, 4608, 18944, 19200, 19456, 
+  19712, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 19968, 4608, 4608, 4608, 4608, 4608, 20224, 
+  4608, 4608, 20480, 20736, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 13056, 13056, 20992, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, 4608, 4608, 4608, 4608, 4608, 4608, 4608, 
+  4608, };
+
+const utf8proc_uint16_t utf8proc_qc_stage2table[] = {
+  0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 0, 0, 0, 0, 0, 0, 
+  0, 80, 0, 80, 0, 0, 0, 0, 
+  80, 0, 0, 80, 80, 80, 80, 0, 
+  0, 80, 80, 80, 0, 80, 80, 80, 
+  0, 17, 17, 17, 17, 17, 17, 0, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 0, 17, 17, 17, 17, 17, 17, 
+  0, 0, 17, 17, 17, 17, 17, 0, 
+  0, 17, 17, 17, 17, 17, 17, 0, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 0, 17, 17, 17, 17, 17, 17, 
+  0, 0, 17, 17, 17, 17, 17, 0, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 0, 0, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 0, 
+  0, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 0, 80, 80, 17, 17, 17, 
+  17, 0, 17, 17, 17, 17, 17, 17, 
+  80, 80, 0, 0, 17, 17, 17, 17, 
+  17, 17, 80, 0, 0, 17, 17, 17, 
+  17, 17, 17, 0, 0, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 0, 
+  0, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 17, 17, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  17, 17, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 0, 17, 
+  17, 17, 17, 17, 17, 0, 0, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 80, 80, 80, 17, 17, 0, 
+  0, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 0, 0, 17, 
+  17, 0, 0, 0, 0, 0, 0, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 0, 
+  0, 80, 80, 80, 80, 80, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 59016, 59016, 59016, 59016, 59016, 58880, 59016, 
+  59016, 59016, 59016, 59016, 59016, 59016, 58880, 58880, 
+  59016, 58880, 59016, 58880, 59016, 59016, 59392, 56320, 
+  56320, 56320, 56320, 59392, 55432, 56320, 56320, 56320, 
+  56320, 56320, 51712, 51712, 56456, 56456, 56456, 56456, 
+  51848, 51848, 56320, 56320, 56320, 56320, 56456, 56456, 
+  56320, 56456, 56456, 56320, 56320, 256, 256, 256, 
+  256, 392, 56320, 56320, 56320, 56320, 58880, 58880, 
+  58880, 58965, 58965, 59016, 58965, 58965, 61576, 58880, 
+  56320, 56320, 56320, 58880, 58880, 58880, 56320, 56320, 
+  0, 58880, 58880, 58880, 56320, 56320, 56320, 56320, 
+  58880, 59392, 56320, 56320, 58880, 59648, 59904, 59904, 
+  59648, 59904, 59904, 59648, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 0, 0, 0, 0, 85, 0, 0, 
+  0, 0, 0, 80, 0, 0, 0, 85, 
+  0, 0, 0, 0, 0, 80, 81, 17, 
+  85, 17, 17, 17, 0, 17, 0, 17, 
+  17, 17, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 17, 17, 17, 17, 17, 
+  17, 17, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 17, 17, 17, 17, 17, 
+  0, 80, 80, 80, 81, 81, 80, 80, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 0, 80, 80, 0, 
+  0, 0, 80, 0, 0, 0, 0, 0, 
+  0, 17, 17, 0, 17, 0, 0, 0, 
+  17, 0, 0, 0, 0, 17, 17, 17, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 17, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 17, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 17, 17, 0, 17, 0, 0, 0, 
+  17, 0, 0, 0, 0, 17, 17, 17, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 17, 
+  17, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 58880, 58880, 58880, 58880, 
+  58880, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 17, 17, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 17, 17, 17, 17, 0, 0, 17, 
+  17, 0, 0, 17, 17, 17, 17, 17, 
+  17, 0, 0, 17, 17, 17, 17, 17, 
+  17, 0, 0, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 0, 
+  0, 17, 17, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 56320, 58880, 58880, 58880, 58880, 56320, 
+  58880, 58880, 58880, 56832, 56320, 58880, 58880, 58880, 
+  58880, 58880, 58880, 56320, 56320, 56320, 56320, 56320, 
+  56320, 58880, 58880, 56320, 58880, 58880, 56832, 58368, 
+  58880, 2560, 2816, 3072, 3328, 3584, 3840, 4096, 
+  4352, 4608, 4864, 4864, 5120, 5376, 5632, 0, 
+  5888, 0, 6144, 6400, 0, 58880, 56320, 0, 
+  4608, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 7680, 7936, 8192, 0, 0, 0, 0, 
+  0, 0, 0, 17, 17, 17, 17, 17, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 6912, 7168, 7424, 7680, 
+  7936, 8192, 8448, 8704, 59016, 59016, 56456, 56320, 
+  58880, 58880, 58880, 58880, 58880, 56320, 58880, 58880, 
+  56320, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 8960, 0, 0, 0, 0, 80, 80, 
+  80, 80, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 17, 0, 17, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 17, 0, 0, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 0, 0, 
+  58880, 58880, 58880, 58880, 56320, 58880, 0, 0, 
+  58880, 58880, 0, 56320, 58880, 58880, 56320, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 9216, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 56320, 58880, 58880, 56320, 58880, 58880, 
+  56320, 56320, 56320, 58880, 56320, 56320, 58880, 56320, 
+  58880, 58880, 58880, 56320, 58880, 56320, 58880, 56320, 
+  58880, 56320, 58880, 58880, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 56320, 58880, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 58880, 
+  58880, 58880, 58880, 0, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 0, 58880, 58880, 
+  58880, 0, 58880, 58880, 58880, 58880, 58880, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 56320, 56320, 56320, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 56320, 58880, 58880, 56320, 
+  58880, 58880, 56320, 58880, 58880, 58880, 56320, 56320, 
+  56320, 6912, 7168, 7424, 58880, 58880, 58880, 56320, 
+  58880, 58880, 56320, 56320, 58880, 58880, 58880, 58880, 
+  58880, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 17, 0, 0, 0, 0, 0, 
+  0, 0, 17, 0, 0, 17, 0, 0, 
+  0, 0, 0, 0, 0, 1928, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 2304, 0, 
+  0, 0, 58880, 56320, 58880, 58880, 0, 0, 
+  0, 85, 85, 85, 85, 85, 85, 85, 
+  85, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 1792, 0, 136, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 17, 17, 2304, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  136, 0, 0, 0, 0, 85, 85, 0, 
+  85, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 85, 0, 0, 85, 
+  0, 0, 0, 0, 0, 1792, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 2304, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 85, 85, 85, 0, 0, 85, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 1792, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 2304, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 1792, 0, 136, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 17, 0, 0, 17, 17, 2304, 0, 
+  0, 0, 0, 0, 0, 0, 0, 136, 
+  136, 0, 0, 0, 0, 85, 85, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 17, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 136, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 17, 17, 17, 2304, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  136, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 17, 0, 0, 0, 0, 2304, 0, 
+  0, 0, 0, 0, 0, 0, 21504, 23432, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 1792, 0, 0, 
+  0, 17, 0, 136, 0, 0, 0, 0, 
+  17, 17, 0, 17, 17, 0, 2304, 0, 
+  0, 0, 0, 0, 0, 0, 136, 136, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 136, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 17, 17, 17, 2304, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  136, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 2440, 0, 0, 0, 0, 
+  136, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 17, 0, 17, 17, 17, 
+  136, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 80, 0, 0, 0, 
+  0, 26368, 26368, 2304, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 27392, 27392, 27392, 27392, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 80, 0, 0, 0, 
+  0, 30208, 30208, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 31232, 31232, 31232, 31232, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 80, 80, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 80, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 56320, 56320, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 56320, 0, 
+  56320, 0, 55296, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 85, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 85, 0, 
+  0, 0, 0, 85, 0, 0, 0, 0, 
+  85, 0, 0, 0, 0, 85, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 85, 0, 0, 0, 0, 0, 
+  0, 0, 33024, 33280, 85, 33792, 85, 85, 
+  80, 85, 80, 33280, 33280, 33280, 33280, 0, 
+  0, 33280, 85, 58880, 58880, 2304, 0, 58880, 
+  58880, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 85, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 85, 0, 
+  0, 0, 0, 85, 0, 0, 0, 0, 
+  85, 0, 0, 0, 0, 85, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 85, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 56320, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 17, 
+  0, 0, 0, 0, 0, 0, 0, 136, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  1792, 0, 2304, 2304, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 56320, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 80, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 136, 136, 136, 136, 136, 136, 
+  136, 136, 136, 136, 136, 136, 136, 136, 
+  136, 136, 136, 136, 136, 136, 136, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 136, 136, 136, 136, 136, 136, 136, 
+  136, 136, 136, 136, 136, 136, 136, 136, 
+  136, 136, 136, 136, 136, 136, 136, 136, 
+  136, 136, 136, 136, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 58880, 58880, 
+  58880, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 2304, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 2304, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 2304, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 58880, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 58368, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 56832, 58880, 56320, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  58880, 56320, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 2304, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 0, 0, 
+  56320, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 58880, 58880, 58880, 58880, 56320, 56320, 
+  56320, 56320, 56320, 56320, 58880, 58880, 56320, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 17, 
+  0, 17, 0, 17, 0, 17, 0, 17, 
+  0, 0, 0, 17, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 1792, 136, 0, 
+  0, 0, 0, 0, 17, 0, 17, 0, 
+  0, 17, 17, 0, 17, 2304, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 58880, 56320, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 2304, 2304, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 1792, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 2304, 2304, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  1792, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 58880, 58880, 0, 256, 56320, 56320, 
+  56320, 56320, 56320, 58880, 58880, 56320, 56320, 56320, 
+  56320, 58880, 0, 256, 256, 256, 256, 256, 
+  256, 256, 0, 0, 0, 0, 56320, 0, 
+  0, 0, 0, 0, 0, 58880, 0, 0, 
+  0, 58880, 58880, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 80, 80, 80, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 0, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 0, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 58880, 58880, 56320, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 56320, 58880, 58880, 59904, 54784, 
+  56320, 51712, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 58880, 0, 
+  0, 0, 0, 0, 0, 59648, 56320, 58880, 
+  56320, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 80, 81, 0, 0, 0, 
+  0, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 0, 0, 0, 0, 0, 
+  0, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 0, 
+  0, 17, 17, 17, 17, 17, 17, 0, 
+  0, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 0, 
+  0, 17, 17, 17, 17, 17, 17, 0, 
+  0, 17, 17, 17, 17, 17, 17, 17, 
+  17, 0, 17, 0, 17, 0, 17, 0, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 85, 17, 85, 17, 85, 17, 
+  85, 17, 85, 17, 85, 17, 85, 0, 
+  0, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 0, 17, 
+  17, 17, 17, 17, 85, 17, 80, 85, 
+  80, 80, 81, 17, 17, 17, 0, 17, 
+  17, 17, 85, 17, 85, 17, 81, 81, 
+  81, 17, 17, 17, 85, 0, 0, 17, 
+  17, 17, 17, 17, 85, 0, 81, 81, 
+  81, 17, 17, 17, 85, 17, 17, 17, 
+  17, 17, 17, 17, 85, 17, 81, 85, 
+  85, 0, 0, 17, 17, 17, 0, 17, 
+  17, 17, 85, 17, 85, 17, 85, 80, 
+  0, 85, 85, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 0, 0, 0, 0, 
+  0, 0, 80, 0, 0, 0, 0, 0, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 80, 80, 80, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  80, 0, 0, 0, 80, 80, 0, 80, 
+  80, 0, 0, 0, 0, 80, 0, 80, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  80, 80, 80, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 0, 0, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 58880, 256, 256, 58880, 58880, 58880, 
+  58880, 256, 256, 256, 58880, 58880, 0, 0, 
+  0, 0, 58880, 0, 0, 0, 256, 256, 
+  58880, 56320, 58880, 256, 256, 56320, 56320, 56320, 
+  56320, 58880, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 0, 80, 80, 
+  80, 0, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 0, 80, 80, 
+  0, 0, 80, 80, 80, 80, 80, 0, 
+  0, 80, 80, 80, 0, 80, 0, 85, 
+  0, 80, 0, 85, 85, 80, 80, 0, 
+  80, 80, 80, 0, 80, 80, 80, 80, 
+  80, 80, 80, 0, 80, 80, 80, 80, 
+  80, 80, 0, 0, 0, 0, 80, 80, 
+  80, 80, 80, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 80, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 17, 17, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 17, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 17, 17, 
+  17, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 17, 0, 0, 
+  0, 0, 17, 0, 0, 17, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 17, 0, 17, 
+  0, 0, 0, 0, 0, 80, 80, 0, 
+  80, 80, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 17, 0, 0, 17, 0, 0, 
+  17, 0, 17, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 17, 0, 17, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 17, 17, 
+  17, 17, 17, 0, 0, 17, 17, 0, 
+  0, 17, 17, 0, 0, 0, 0, 0, 
+  0, 17, 17, 0, 0, 17, 17, 0, 
+  0, 17, 17, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 17, 17, 17, 
+  17, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 17, 17, 17, 17, 0, 0, 0, 
+  0, 0, 0, 17, 17, 17, 17, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 85, 85, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 80, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 80, 80, 80, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 85, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 80, 80, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  58880, 58880, 58880, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  2304, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 80, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 55808, 58368, 59392, 56832, 57344, 
+  57344, 0, 0, 0, 0, 0, 0, 80, 
+  0, 80, 80, 80, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 17, 0, 17, 
+  0, 17, 0, 17, 0, 17, 0, 17, 
+  0, 17, 0, 17, 0, 17, 0, 17, 
+  0, 17, 0, 17, 0, 0, 17, 0, 
+  17, 0, 17, 0, 0, 0, 0, 0, 
+  0, 17, 17, 0, 17, 17, 0, 17, 
+  17, 0, 17, 17, 0, 17, 17, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 17, 0, 0, 
+  0, 0, 2184, 2184, 80, 80, 0, 17, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 17, 0, 17, 
+  0, 17, 0, 17, 0, 17, 0, 17, 
+  0, 17, 0, 17, 0, 17, 0, 17, 
+  0, 17, 0, 17, 0, 0, 17, 0, 
+  17, 0, 17, 0, 0, 0, 0, 0, 
+  0, 17, 17, 0, 17, 17, 0, 17, 
+  17, 0, 17, 17, 0, 17, 17, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 17, 0, 0, 
+  17, 17, 17, 17, 0, 0, 0, 17, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  0, 0, 0, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  58880, 0, 0, 0, 0, 58880, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 58880, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 80, 80, 58880, 
+  58880, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 58880, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 2304, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 2304, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  58880, 58880, 58880, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 56320, 56320, 56320, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 2304, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 1792, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 2304, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 0, 58880, 58880, 56320, 0, 0, 
+  58880, 58880, 0, 0, 0, 0, 0, 58880, 
+  58880, 0, 58880, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 2304, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 80, 80, 80, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 2304, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 17, 17, 17, 
+  17, 17, 17, 17, 17, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 0, 
+  0, 85, 0, 85, 0, 0, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  0, 85, 0, 85, 0, 0, 85, 85, 
+  0, 0, 0, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 0, 
+  0, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 80, 80, 80, 80, 
+  80, 0, 0, 0, 0, 0, 85, 6656, 
+  85, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  0, 85, 85, 85, 85, 85, 0, 85, 
+  0, 85, 85, 0, 85, 85, 0, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 0, 0, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 0, 0, 0, 0, 0, 
+  0, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  56320, 56320, 56320, 56320, 56320, 56320, 56320, 58880, 
+  58880, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 0, 0, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 0, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  0, 80, 80, 80, 80, 0, 0, 0, 
+  0, 80, 80, 80, 0, 80, 0, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 0, 0, 
+  0, 0, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  0, 0, 0, 80, 80, 80, 80, 80, 
+  80, 0, 0, 80, 80, 80, 80, 80, 
+  80, 0, 0, 80, 80, 80, 80, 80, 
+  80, 0, 0, 80, 80, 80, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 56320, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 56320, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 58880, 
+  58880, 58880, 58880, 58880, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 56320, 0, 
+  58880, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 256, 56320, 0, 0, 0, 0, 
+  2304, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 58880, 56320, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 2304, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  2304, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 17, 0, 17, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 17, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 2304, 1928, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 58880, 58880, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  136, 0, 0, 0, 0, 0, 0, 17, 
+  17, 0, 0, 0, 2304, 2304, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 1792, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 2304, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 1792, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 2304, 1792, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 1792, 2304, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 1792, 0, 136, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 17, 17, 2304, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  136, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 58880, 
+  58880, 58880, 58880, 58880, 58880, 58880, 0, 0, 
+  0, 58880, 58880, 58880, 58880, 58880, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 136, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 136, 17, 17, 136, 17, 
+  0, 0, 0, 2304, 1792, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  136, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 17, 17, 0, 0, 0, 
+  2304, 1792, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  2304, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 2304, 
+  1792, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 2304, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 256, 256, 256, 256, 256, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 58880, 58880, 58880, 58880, 58880, 58880, 58880, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 256, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 85, 
+  85, 85, 85, 85, 85, 85, 55296, 55296, 
+  256, 256, 256, 0, 0, 0, 57856, 55296, 
+  55296, 55296, 55296, 55296, 0, 0, 0, 0, 
+  0, 0, 0, 0, 56320, 56320, 56320, 56320, 
+  56320, 56320, 56320, 56320, 0, 0, 58880, 58880, 
+  58880, 58880, 58880, 56320, 56320, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 58880, 58880, 58880, 58880, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 85, 85, 85, 85, 
+  85, 85, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 58880, 58880, 58880, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 0, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 0, 80, 
+  80, 0, 0, 80, 0, 0, 80, 80, 
+  0, 0, 80, 80, 80, 80, 0, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 0, 80, 0, 80, 80, 
+  80, 80, 80, 80, 80, 0, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 0, 
+  80, 80, 80, 80, 0, 0, 80, 80, 
+  80, 80, 80, 80, 80, 80, 0, 80, 
+  80, 80, 80, 80, 80, 80, 0, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 0, 80, 80, 80, 80, 
+  0, 80, 80, 80, 80, 80, 0, 80, 
+  0, 0, 0, 80, 80, 80, 80, 80, 
+  80, 80, 0, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 0, 0, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 56320, 56320, 56320, 56320, 56320, 56320, 56320, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 0, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 0, 80, 80, 0, 80, 0, 0, 
+  80, 0, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 0, 80, 80, 80, 
+  80, 0, 80, 0, 80, 0, 0, 0, 
+  0, 0, 0, 80, 0, 0, 0, 0, 
+  80, 0, 80, 0, 80, 0, 80, 80, 
+  80, 0, 80, 80, 0, 80, 0, 0, 
+  80, 0, 80, 0, 80, 0, 80, 0, 
+  80, 0, 80, 80, 0, 80, 0, 0, 
+  80, 80, 80, 80, 0, 80, 80, 80, 
+  80, 80, 80, 80, 0, 80, 80, 80, 
+  80, 0, 80, 80, 80, 80, 0, 80, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 0, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 0, 0, 0, 
+  0, 0, 80, 80, 80, 0, 80, 80, 
+  80, 80, 80, 0, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 80, 80, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 80, 80, 0, 0, 0, 0, 
+  0, 80, 80, 80, 80, 80, 80, 80, 
+  80, 80, 0, 0, 0, 0, 0, 0, 
+  0, 80, 80, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 85, 
+  85, 85, 85, 85, 85, 85, 85, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0, 
+  0, };
+